@@ -0,0 +1,272 @@
+/*
+File Name: Centrality.h
+Date Begun: 10/18/2026
+
+This header file contains the interface and implementation (for ease of
+compilation) of the Centrality class, which computes betweenness (Brandes'
+algorithm), closeness and harmonic centrality for every vertex of a Graph.
+
+All three are accumulated from one incremental Dijkstra search (see
+Graph::search) per source vertex. Sources are divided among threads; each
+thread keeps its own search state and accumulators, all of size O(V), which
+are summed once every source has been searched. In sampled mode only a random
+sample of sources is searched and the results are extrapolated to the whole
+Graph, trading accuracy for time.
+
+Closeness and harmonic centrality are measured on distances from the other
+vertices to a vertex (as for incoming paths), which lets both be estimated
+from a sample of sources in the same way as betweenness. Closeness is scaled
+by the fraction of other vertices that reach the vertex (Wasserman and Faust),
+so that it stays comparable across vertices reached by different numbers of
+others.
+
+PUBLIC OPERATIONS:
+* compute(samples, seed)			Return the centrality of every vertex.
+* outputCentrality(samples, seed)	Print the centrality of every vertex.
+
+*/
+
+#ifndef Centrality_h
+#define Centrality_h
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits.h>
+#include <thread>
+#include <vector>
+#include "Graph.h"
+using namespace std;
+
+class Centrality {
+public:
+
+		// PUBLIC STRUCT - SCORES (indexed by vertex identity - 1)
+		struct Scores {
+			vector<double> betweenness_;
+			vector<double> closeness_;
+			vector<double> harmonic_;
+			int sources_; // Number of sources searched.
+		};
+
+		// Constructor
+		// @graph					Graph to analyze (must outlive this object).
+		// @numberOfThreads		Number of threads to search sources on; 0 selects
+		//								the number of hardware threads.
+		explicit Centrality(const Graph &graph, const int numberOfThreads = 0) :
+			graph_(graph), number_of_threads_{numberOfThreads > 0 ?
+				numberOfThreads :
+				max(1, static_cast<int>(thread::hardware_concurrency()))} { }
+
+		// Compute the betweenness, closeness and harmonic centrality of every
+		// vertex, exactly or from a sample of sources.
+		// @samples				Number of sources to sample; 0 (or at least the
+		//							number of vertices) searches every vertex exactly.
+		// @seed					Seed for choosing the sample.
+		// @return				Scores of every vertex. Betweenness counts shortest
+		//							paths between ordered pairs of other vertices.
+		// Pre-Condition:		Shortest paths are counted over edges of positive
+		//							weight; of equal-cost paths joined only by zero
+		//							weight edges, just one is counted.
+		Scores compute(const int samples = 0, unsigned seed = 1) const {
+			const int size = graph_.numberOfVertices();
+
+			// Choose the sources: all vertices, or a random sample of them.
+			vector<int> sources(size);
+			for(int i = 0; i < size; i++) {
+				sources[i] = i;
+			}
+
+			if(samples > 0 && samples < size) {
+				for(int i = 0; i < samples; i++) {
+					swap(sources[i], sources[i + rand_r(&seed) % (size - i)]);
+				}
+				sources.resize(samples);
+			}
+
+			// Search the sources in parallel into per-thread accumulators.
+			const int threads = max(1, min(number_of_threads_,
+													 static_cast<int>(sources.size())));
+			vector<Workspace> workspaces(threads, Workspace(size));
+			vector<thread> workers;
+
+			for(int t = 0; t < threads; t++) {
+				workers.push_back(thread([&, t] {
+					for(size_t i = t; i < sources.size(); i += threads) {
+						searchSource(sources[i], workspaces[t]);
+					}
+				}));
+			}
+			for(size_t t = 0; t < workers.size(); t++) {
+				workers[t].join();
+			}
+
+			for(int t = 1; t < threads; t++) {
+				for(int v = 0; v < size; v++) {
+					workspaces[0].betweenness_[v] += workspaces[t].betweenness_[v];
+					workspaces[0].total_distance_[v] += workspaces[t].total_distance_[v];
+					workspaces[0].reached_by_[v] += workspaces[t].reached_by_[v];
+					workspaces[0].harmonic_[v] += workspaces[t].harmonic_[v];
+				}
+			}
+
+			// Extrapolate sums over the sources to sums over all vertices.
+			const Workspace &total = workspaces[0];
+			vector<bool> isSource(size, false);
+			for(size_t i = 0; i < sources.size(); i++) {
+				isSource[sources[i]] = true;
+			}
+
+			Scores scores;
+			scores.sources_ = static_cast<int>(sources.size());
+			scores.betweenness_.assign(size, 0.0);
+			scores.closeness_.assign(size, 0.0);
+			scores.harmonic_.assign(size, 0.0);
+
+			for(int v = 0; v < size; v++) {
+				const int others = scores.sources_ - (isSource[v] ? 1 : 0);
+				if(others == 0) {
+					continue;
+				}
+
+				const double scale = static_cast<double>(size - 1) / others;
+				scores.betweenness_[v] = total.betweenness_[v] *
+					static_cast<double>(size) / scores.sources_;
+				scores.harmonic_[v] = total.harmonic_[v] * scale;
+
+				if(total.total_distance_[v] > 0.0) {
+					scores.closeness_[v] = (total.reached_by_[v] /
+						total.total_distance_[v]) *
+						(total.reached_by_[v] * scale / (size - 1));
+				}
+			}
+
+			return scores;
+		}
+
+		// Print the betweenness, closeness and harmonic centrality of every
+		// vertex, one per line.
+		// @samples				Number of sources to sample, as for compute.
+		// @seed					Seed for choosing the sample.
+		void outputCentrality(const int samples = 0, const unsigned seed = 1) const {
+			const Scores scores = compute(samples, seed);
+
+			for(size_t i = 0; i < scores.betweenness_.size(); i++) {
+				cout << i + 1 << ": Betweenness: " << fixed << setprecision(3)
+					  << scores.betweenness_[i] << ", Closeness: "
+					  << setprecision(5) << scores.closeness_[i] << ", Harmonic: "
+					  << scores.harmonic_[i] << endl;
+			}
+			cout << "Sources Searched: " << scores.sources_ << endl << endl;
+		}
+
+private:
+
+	// PRIVATE STRUCT - WORKSPACE (search arrays and accumulators of a thread)
+	struct Workspace {
+		Graph::SearchState state_;
+		vector<int> order_;			// Vertices in the order settled.
+		vector<int> position_;		// Position in order_; -1 if not settled.
+		vector<double> paths_;		// Number of shortest paths from the source.
+		vector<double> dependency_;	// Brandes' dependency of the source.
+
+		vector<double> betweenness_;
+		vector<double> total_distance_;
+		vector<double> reached_by_;
+		vector<double> harmonic_;
+
+		explicit Workspace(const int size) : state_(size), position_(size, -1),
+			paths_(size, 0.0), dependency_(size, 0.0), betweenness_(size, 0.0),
+			total_distance_(size, 0.0), reached_by_(size, 0.0),
+			harmonic_(size, 0.0) { }
+	};
+
+	const Graph &graph_;
+	int number_of_threads_;
+
+
+	/*
+	*****************************************************************************
+	****************************PRIVATE FUNCTIONS********************************
+	*****************************************************************************
+	*/
+
+	// Search from one source and add its contribution to a thread's
+	// accumulators. Only the vertices the search settled are reset.
+	// @source		Index (identity - 1) of the source vertex.
+	// @workspace	Search arrays and accumulators of the calling thread.
+	void searchSource(const int source, Workspace &workspace) const {
+		vector<int> &order = workspace.order_;
+		vector<int> &position = workspace.position_;
+		vector<double> &paths = workspace.paths_;
+		vector<double> &dependency = workspace.dependency_;
+		const Graph::SearchState &state = workspace.state_;
+
+		order.clear();
+		graph_.search(source + 1, workspace.state_,
+			[](const int, const int, const float) { return true; },
+			[&](const int v, const float) {
+				position[v] = static_cast<int>(order.size());
+				order.push_back(v);
+				return true;
+			});
+
+		// Count shortest paths in the order settled: every edge on a shortest
+		// path leads to a vertex settled later.
+		paths[source] = 1.0;
+		for(size_t i = 0; i < order.size(); i++) {
+			const int v = order[i];
+			forEachShortestPathEdge(v, state, position, [&](const int w) {
+				paths[w] += paths[v];
+			});
+		}
+
+		// Accumulate dependencies in reverse order (Brandes).
+		for(size_t i = order.size(); i > 0; i--) {
+			const int v = order[i - 1];
+			forEachShortestPathEdge(v, state, position, [&](const int w) {
+				dependency[v] += paths[v] / paths[w] * (1.0 + dependency[w]);
+			});
+
+			if(v != source) {
+				const float distance = state.distance(v);
+
+				workspace.betweenness_[v] += dependency[v];
+				workspace.total_distance_[v] += distance;
+				workspace.reached_by_[v] += 1.0;
+				if(distance > 0.0) {
+					workspace.harmonic_[v] += 1.0 / distance;
+				}
+			}
+		}
+
+		for(size_t i = 0; i < order.size(); i++) {
+			position[order[i]] = -1;
+			paths[order[i]] = 0.0;
+			dependency[order[i]] = 0.0;
+		}
+	}
+
+	// Call f(w) for every edge v -> w that lies on a shortest path from the
+	// last source searched, i.e. that reaches w at its distance and w was
+	// settled after v.
+	template <typename Function>
+	void forEachShortestPathEdge(const int v, const Graph::SearchState &state,
+										  const vector<int> &position,
+										  Function f) const {
+		const Graph::Vertex &opV = graph_.graph_vertices_[v];
+		const float distanceV = state.distance(v);
+
+		for(size_t i = 0; i < opV.adjacent_vertices_.size(); i++) {
+			const int w = opV.adjacent_vertices_[i];
+			if(opV.edge_weights_[i] >= 0.0 && position[w] > position[v] &&
+				distanceV + opV.edge_weights_[i] == state.distance(w)) {
+				f(w);
+			}
+		}
+	}
+
+};
+
+#endif /* Centrality_h */
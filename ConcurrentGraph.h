@@ -0,0 +1,577 @@
+/*
+File Name: ConcurrentGraph.h
+Date Begun: 10/18/2026
+
+This header file contains the interface and implementation (for ease of
+compilation) of the ConcurrentGraph class, which lets edges be added, removed
+and reweighted in a Graph while any number of readers keep querying it.
+
+Each published version of the graph is an immutable Snapshot: a shared base
+Graph plus a small delta of edges added, removed or reweighted since the base
+was built (a removal is recorded as a tombstone in the delta). The delta is a
+persistent radix tree over origin vertices whose leaves hold each origin's
+changed edges, so a writer copies only the changed origin's edges and the few
+nodes on its path, shares the rest with the previous version, and atomically
+publishes a new Snapshot (copy-on-write); readers pin the current Snapshot and
+query it without taking any lock, seeing one consistent version for as long
+as they hold it. Once the delta grows past a threshold, a background thread
+merges it into a new base Graph and publishes that. The new base shares the
+edges of every vertex the delta did not touch with the old one, and only the
+touched vertices are rewritten (dropping their removed edges); once the space
+left behind by rewritten vertices outgrows half the edges, the merge packs the
+new base instead, so removed edges are reclaimed in the background rather
+than by writers.
+
+PUBLIC OPERATIONS:
+* pin()								Return the current Snapshot.
+* addEdge(from, to, edge weight)	Add a (directed) edge and publish it.
+* addEdges(edges)					Add several edges and publish them at once.
+* removeEdge(from, to)				Remove a (directed) edge and publish it.
+* updateWeight(from, to, edge weight)
+										Change the weight of an edge and publish it.
+* merge()							Merge the delta into the base now.
+
+SNAPSHOT OPERATIONS:
+* isConnected(from, to)			Check if two vertices are connected.
+* search(from, state, visit)	Incremental Dijkstra search (see Graph::search).
+* shortestPaths(from, distance, previous)
+										Run Dijkstra's algorithm into caller-owned arrays.
+
+*/
+
+#ifndef ConcurrentGraph_h
+#define ConcurrentGraph_h
+
+#include <atomic>
+#include <condition_variable>
+#include <iostream>
+#include <limits.h>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "Graph.h"
+using namespace std;
+
+class ConcurrentGraph {
+
+	struct Delta; // Defined below.
+
+public:
+
+		// PUBLIC STRUCT - EDGE (as passed to addEdges; identities as in addEdge)
+		struct Edge {
+			int from_;
+			int to_;
+			float weight_;
+		};
+
+		// PUBLIC CLASS - SNAPSHOT (one immutable, consistent version)
+		class Snapshot {
+		public:
+
+				// @return	Number of vertices.
+				int numberOfVertices() const {
+					return base_->numberOfVertices();
+				}
+
+				// @return	Version number; every publish increments it.
+				long version() const {
+					return version_;
+				}
+
+				// @return	Number of edge changes held in the delta (not yet
+				//				merged).
+				size_t deltaSize() const {
+					return delta_->changes_;
+				}
+
+				// @return	Number of edge changes made up to this version, merged
+				//				or not (since the ConcurrentGraph was constructed).
+				long changes() const {
+					return changes_;
+				}
+
+				// Check for existing edge/connection between two vertices.
+				// @from		Identity (integer) of origin vertex.
+				// @to		Identity (integer) of target vertex.
+				// @return	Weight (float) of existing edge; else sentinel value of
+				//				-1.0 to signal no existing edge.
+				float isConnected(const int from, const int to) const {
+					const pair<int, float> *change = delta_->find(from - 1, to - 1);
+					if(change != nullptr) {
+						return change->second < 0.0 ? -1.0 : change->second;
+					}
+
+					return base_->isConnected(from, to);
+				}
+
+				// Incremental Dijkstra search over the base and delta edges; see
+				// Graph::search. Base edges changed in the delta are masked out and
+				// followed at their delta weight instead, unless removed.
+				template <typename Visitor>
+				void search(const int from, Graph::SearchState &state,
+								Visitor visit) const {
+					const Delta &delta = *delta_;
+					int origin = -1;
+					const Delta::Bucket *changed = nullptr;
+
+					base_->search(vector<int>(1, from), state,
+						[&](const int v, const int w, const float) {
+							if(v != origin) {
+								origin = v;
+								changed = delta.bucket(v);
+							}
+							return changed == nullptr ||
+								Delta::find(*changed, w) == nullptr;
+						}, visit, ExtraEdges(delta));
+				}
+
+				// Computes shortest paths from an origin vertex over the base and
+				// delta edges; see Graph::shortestPaths.
+				void shortestPaths(const int from, vector<float> &distance,
+										 vector<int> &previous) const {
+					Graph::SearchState state(numberOfVertices());
+					search(from, state, [](const int, const float) { return true; });
+
+					distance.resize(numberOfVertices());
+					previous.resize(numberOfVertices());
+					for(int i = 0; i < numberOfVertices(); i++) {
+						distance[i] = state.distance(i);
+						previous[i] = state.previous(i);
+					}
+				}
+
+		private:
+
+			shared_ptr<const Graph> base_;
+			shared_ptr<const Delta> delta_;
+			long version_;
+			long changes_;
+
+			friend class ConcurrentGraph;
+		};
+
+		// Constructor
+		// @base					Initial Graph (taken over by the ConcurrentGraph).
+		// @mergeThreshold	Delta size (edges) at which a background merge
+		//							starts.
+		explicit ConcurrentGraph(Graph &&base,
+										 const size_t mergeThreshold = 4096) :
+			merge_threshold_{mergeThreshold > 0 ? mergeThreshold : 1},
+			merges_{0}, packed_edges_{base.liveEdges()},
+			abandoned_slots_{0}, stopping_{false}, merge_requested_{false} {
+			shared_ptr<Snapshot> first = make_shared<Snapshot>();
+			first->base_ = Graph::share(std::move(base));
+			first->delta_ = make_shared<const Delta>(first->numberOfVertices());
+			first->version_ = 0;
+			first->changes_ = 0;
+			current_ = first;
+
+			merger_ = thread(&ConcurrentGraph::mergeLoop, this);
+		}
+
+		// Destructor - stop the background merge thread.
+		~ConcurrentGraph() {
+			{
+				lock_guard<mutex> lock(write_mutex_);
+				stopping_ = true;
+			}
+			merge_wake_.notify_all();
+			merger_.join();
+		}
+
+		// @return		The current Snapshot; it stays valid and unchanged for as
+		//					long as the caller holds it, whatever is written since.
+		shared_ptr<const Snapshot> pin() const {
+			return atomic_load(&current_);
+		}
+
+		// Add a directed edge between two vertices and publish it.
+		// @from					Identity (integer) of the origin vertex.
+		// @to					Identity (integer) of the target vertex.
+		// edgeWeight			A non-negative weight (float) for the new edge.
+		// Pre-Conditions:	As for Graph::addEdge; checked, and existing edges and
+		//							self-loops are ignored in the same way.
+		void addEdge(const int from, const int to, const float edgeWeight) {
+			Edge e = {from, to, edgeWeight};
+			addEdges(vector<Edge>(1, e));
+		}
+
+		// Add several directed edges (as addEdge) and publish them as a single
+		// new version.
+		// @edges				Edges to add, in order.
+		void addEdges(const vector<Edge> &edges) {
+			lock_guard<mutex> lock(write_mutex_);
+			shared_ptr<const Snapshot> snapshot = atomic_load(&current_);
+			const int size = snapshot->numberOfVertices();
+
+			shared_ptr<Delta> delta = make_shared<Delta>(*snapshot->delta_);
+			Snapshot view(*snapshot);
+			view.delta_ = delta;
+
+			for(size_t i = 0; i < edges.size(); i++) {
+				const Edge &e = edges[i];
+
+				// Check valid input
+				if(e.from_ < 1 || e.from_ > size || e.to_ < 1 || e.to_ > size ||
+					e.weight_ < 0.0) {
+					cout << "Invalid input! Please provide vertex selections between "
+						  << "1 and " << size << " and positive edge "
+						  << "edge weight." << endl << endl;
+					continue;
+				}
+
+				if(e.from_ == e.to_ || view.isConnected(e.from_, e.to_) != -1.0) {
+					continue;
+				}
+
+				delta->set(e.from_ - 1, e.to_ - 1, e.weight_);
+			}
+
+			commit(snapshot->base_, delta);
+		}
+
+		// Remove a directed edge between two vertices and publish the removal.
+		// @from					Identity (integer) of the origin vertex.
+		// @to					Identity (integer) of the target vertex.
+		// @return				True if the edge existed and has been removed.
+		// Pre-Condition:		As for Graph::removeEdge; checked in the function.
+		bool removeEdge(const int from, const int to) {
+			return change(from, to, -1.0);
+		}
+
+		// Change the weight of an existing directed edge and publish it.
+		// @from					Identity (integer) of the origin vertex.
+		// @to					Identity (integer) of the target vertex.
+		// @edgeWeight			The new non-negative weight (float) of the edge.
+		// @return				True if the edge exists and has been updated.
+		// Pre-Conditions:	As for Graph::updateWeight; checked in the function.
+		bool updateWeight(const int from, const int to, const float edgeWeight) {
+			if(edgeWeight < 0.0) {
+				cout << "Invalid input! Please provide vertex selections between "
+					  << "1 and " << pin()->numberOfVertices() << " and positive "
+					  << "edge edge weight." << endl << endl;
+				return false;
+			}
+
+			return change(from, to, edgeWeight);
+		}
+
+		// Merge the current delta into a new base Graph immediately (on the
+		// calling thread) and publish it.
+		void merge() {
+			mergeOnce();
+		}
+
+		// @return		Number of merges completed so far.
+		long numberOfMerges() const {
+			return merges_;
+		}
+
+private:
+
+	// PRIVATE STRUCT - DELTA (edge changes since the base was built)
+	// A persistent radix tree over origin indices, kBits of the index per
+	// level, whose leaves are buckets of (target index, weight) of each edge
+	// changed since the base was built, at its latest weight; a negative
+	// weight is a tombstone for a removed edge. Nodes are never changed once
+	// published: set() copies the bucket and the nodes on its path and shares
+	// every other node, so copying a Delta is O(1).
+	struct Delta {
+		typedef vector<pair<int, float>> Bucket;
+
+		struct Node {
+			vector<shared_ptr<const Node>> children_; // Empty in a leaf.
+			Bucket edges_;										// Leaf only.
+		};
+
+		static const int kBits = 5;
+		static const int kFanout = 1 << kBits;
+
+		shared_ptr<const Node> root_; // nullptr if nothing has changed.
+		int levels_;						// Levels of nodes above the leaves.
+		size_t changes_;					// Changes made, including overwritten ones.
+
+		explicit Delta(const int size) : levels_{0}, changes_{0} {
+			while((1L << (kBits * levels_)) < size) {
+				levels_++;
+			}
+		}
+
+		// @return	The changed edges of an origin; nullptr if it has none.
+		const Bucket *bucket(const int from) const {
+			const Node *node = root_.get();
+			for(int level = levels_; node != nullptr && level > 0; level--) {
+				node = node->children_[slot(from, level)].get();
+			}
+			return node != nullptr ? &node->edges_ : nullptr;
+		}
+
+		// @return	The latest change to an edge in a bucket; nullptr if none.
+		static const pair<int, float> *find(const Bucket &edges, const int to) {
+			for(size_t i = 0; i < edges.size(); i++) {
+				if(edges[i].first == to) {
+					return &edges[i];
+				}
+			}
+			return nullptr;
+		}
+
+		// @return	The latest change to an edge; nullptr if it is unchanged.
+		const pair<int, float> *find(const int from, const int to) const {
+			const Bucket *edges = bucket(from);
+			return edges != nullptr ? find(*edges, to) : nullptr;
+		}
+
+		void set(const int from, const int to, const float weight) {
+			root_ = set(root_, levels_, from, to, weight);
+			changes_++;
+		}
+
+		// Call f(from, changes) with each origin's bucket.
+		template <typename Function>
+		void forEachBucket(Function f) const {
+			forEachBucket(root_.get(), levels_, 0, f);
+		}
+
+		// Call f(from, to, weight) with each change made since an earlier
+		// version of this Delta (one per edge, at its latest weight), skipping
+		// the subtrees the two still share.
+		template <typename Function>
+		void forEachChangeSince(const Delta &earlier, Function f) const {
+			forEachChangeSince(root_.get(), earlier.root_.get(), levels_, 0, f);
+		}
+
+	private:
+
+		// @return	Child index of an origin at a level.
+		static int slot(const int from, const int level) {
+			return (from >> (kBits * (level - 1))) & (kFanout - 1);
+		}
+
+		// @return	A copy of a subtree (nullptr if empty) with one more change.
+		static shared_ptr<const Node> set(const shared_ptr<const Node> &node,
+													 const int level, const int from,
+													 const int to, const float weight) {
+			shared_ptr<Node> copy = node != nullptr ? make_shared<Node>(*node) :
+				make_shared<Node>();
+
+			if(level == 0) {
+				pair<int, float> *change =
+					const_cast<pair<int, float> *>(find(copy->edges_, to));
+				if(change != nullptr) {
+					change->second = weight;
+				}
+				else {
+					copy->edges_.push_back(make_pair(to, weight));
+				}
+			}
+			else {
+				if(copy->children_.empty()) {
+					copy->children_.resize(kFanout);
+				}
+				shared_ptr<const Node> &child = copy->children_[slot(from, level)];
+				child = set(child, level - 1, from, to, weight);
+			}
+
+			return copy;
+		}
+
+		template <typename Function>
+		static void forEachBucket(const Node *node, const int level,
+										  const int prefix, Function &f) {
+			if(node == nullptr) {
+				return;
+			}
+			if(level == 0) {
+				f(prefix, node->edges_);
+				return;
+			}
+			for(int i = 0; i < kFanout; i++) {
+				forEachBucket(node->children_[i].get(), level - 1,
+								  (prefix << kBits) | i, f);
+			}
+		}
+
+		template <typename Function>
+		static void forEachChangeSince(const Node *node, const Node *earlier,
+												 const int level, const int prefix,
+												 Function &f) {
+			if(node == nullptr || node == earlier) {
+				return;
+			}
+			if(level == 0) {
+				for(size_t i = 0; i < node->edges_.size(); i++) {
+					const pair<int, float> &change = node->edges_[i];
+					const pair<int, float> *before = earlier != nullptr ?
+						find(earlier->edges_, change.first) : nullptr;
+					if(before == nullptr || before->second != change.second) {
+						f(prefix, change.first, change.second);
+					}
+				}
+				return;
+			}
+			for(int i = 0; i < kFanout; i++) {
+				forEachChangeSince(node->children_[i].get(),
+					earlier != nullptr ? earlier->children_[i].get() : nullptr,
+					level - 1, (prefix << kBits) | i, f);
+			}
+		}
+	};
+
+	// PRIVATE STRUCT - EXTRAEDGES (feeds delta edges to Graph::search)
+	struct ExtraEdges {
+		const Delta &delta_;
+
+		explicit ExtraEdges(const Delta &delta) : delta_(delta) { }
+
+		template <typename Relax>
+		void operator()(const int v, Relax &relax) const {
+			const Delta::Bucket *edges = delta_.bucket(v);
+			if(edges != nullptr) {
+				for(size_t i = 0; i < edges->size(); i++) {
+					if((*edges)[i].second >= 0.0) {
+						relax((*edges)[i].first, (*edges)[i].second);
+					}
+				}
+			}
+		}
+	};
+
+	shared_ptr<const Snapshot> current_; // Accessed only atomically.
+	size_t merge_threshold_;
+	atomic<long> merges_;
+	// Live directed edges of the base when it was last packed, and slots left
+	// behind by vertices rewritten by merges since (guarded by merge_mutex_).
+	long packed_edges_;
+	long abandoned_slots_;
+
+	mutex write_mutex_;		// Serializes writers (and merge publishing).
+	mutex merge_mutex_;		// Serializes merges.
+	condition_variable merge_wake_;
+	bool stopping_;
+	bool merge_requested_;
+	thread merger_;
+
+
+	/*
+	*****************************************************************************
+	****************************PRIVATE FUNCTIONS********************************
+	*****************************************************************************
+	*/
+
+	// Change (or, with a negative weight, remove) an existing edge.
+	// @return		True if the edge exists and has been changed.
+	bool change(const int from, const int to, const float weight) {
+		lock_guard<mutex> lock(write_mutex_);
+		shared_ptr<const Snapshot> snapshot = atomic_load(&current_);
+		const int size = snapshot->numberOfVertices();
+
+		// Check valid input
+		if(from < 1 || from > size || to < 1 || to > size) {
+			cout << "Invalid vertex selections! Please provide selections "
+				  << "between 1 and " << size << endl << endl;
+			return false;
+		}
+
+		if(snapshot->isConnected(from, to) == -1.0) {
+			return false;
+		}
+
+		shared_ptr<Delta> delta = make_shared<Delta>(*snapshot->delta_);
+		delta->set(from - 1, to - 1, weight);
+		commit(snapshot->base_, delta);
+		return true;
+	}
+
+	// Publish a new delta and request a merge once it is large enough. Caller
+	// holds write_mutex_.
+	void commit(const shared_ptr<const Graph> &base,
+					const shared_ptr<const Delta> &delta) {
+		publish(base, delta);
+
+		if(delta->changes_ >= merge_threshold_) {
+			merge_requested_ = true;
+			merge_wake_.notify_one();
+		}
+	}
+
+	// Atomically publish a new version. Caller holds write_mutex_.
+	void publish(const shared_ptr<const Graph> &base,
+					 const shared_ptr<const Delta> &delta) {
+		shared_ptr<const Snapshot> current = atomic_load(&current_);
+		shared_ptr<Snapshot> next = make_shared<Snapshot>();
+		next->base_ = base;
+		next->delta_ = delta;
+		next->version_ = current->version_ + 1;
+		// A writer extends the current delta; a merge only moves changes
+		// into a new base.
+		next->changes_ = current->changes_ + (base == current->base_ ?
+			static_cast<long>(delta->changes_ - current->delta_->changes_) : 0);
+		atomic_store(&current_, shared_ptr<const Snapshot>(next));
+	}
+
+	// Background thread: merge whenever a writer requests it.
+	void mergeLoop() {
+		unique_lock<mutex> lock(write_mutex_);
+
+		while(true) {
+			merge_wake_.wait(lock, [this] {
+				return stopping_ || merge_requested_;
+			});
+
+			if(stopping_) {
+				return;
+			}
+
+			merge_requested_ = false;
+			lock.unlock();
+			mergeOnce();
+			lock.lock();
+		}
+	}
+
+	// Build a new base Graph from a pinned Snapshot's base and delta, without
+	// blocking readers or writers, then publish it with a delta holding only
+	// the changes made while the merge ran. Only the vertices with changed
+	// edges are rewritten; the rest keep sharing the old base's edge blocks
+	// until the space left behind calls for packing the whole base.
+	void mergeOnce() {
+		lock_guard<mutex> mergeLock(merge_mutex_);
+		shared_ptr<const Snapshot> snapshot = pin();
+		const Delta &merged = *snapshot->delta_;
+
+		if(merged.changes_ == 0) {
+			return;
+		}
+
+		shared_ptr<Graph> base =
+			make_shared<Graph>(snapshot->base_->shareEdges());
+		merged.forEachBucket([&](const int from, const Delta::Bucket &changes) {
+			abandoned_slots_ += base->rewriteEdges(from, changes);
+		});
+
+		if(2 * abandoned_slots_ > packed_edges_) {
+			base->compact();
+			packed_edges_ = base->liveEdges();
+			abandoned_slots_ = 0;
+		}
+
+		lock_guard<mutex> lock(write_mutex_);
+		const Delta &latest = *atomic_load(&current_)->delta_;
+		shared_ptr<Delta> delta = make_shared<Delta>(base->numberOfVertices());
+		latest.forEachChangeSince(merged,
+			[&](const int from, const int to, const float weight) {
+				delta->set(from, to, weight);
+			});
+		delta->changes_ = latest.changes_ - merged.changes_;
+
+		publish(base, delta);
+		merges_++;
+	}
+
+};
+
+#endif /* ConcurrentGraph_h */
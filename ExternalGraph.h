@@ -0,0 +1,631 @@
+/*
+File Name: ExternalGraph.h
+Date Begun: 10/18/2026
+
+This header file contains the interface and implementation (for ease of
+compilation) of the ExternalGraph class, an out-of-core (external memory)
+representation of a directed graph for graphs with more edges than fit in
+memory. The adjacency lists are partitioned into on-disk blocks of
+consecutive vertices, sized in bytes as a fraction of the buffer pool (so a
+block holds many low-degree vertices or few high-degree ones); only
+per-vertex distance/path arrays, a block index and a bounded buffer pool of
+blocks are kept resident.
+
+Shortest paths are found block by block rather than vertex by vertex: a
+priority queue of blocks, keyed by the smallest tentative distance of any of
+their vertices awaiting a scan, picks the next block to load, and every
+waiting vertex of that block is scanned (in order of distance, following
+edges within the block straight away) while it is resident. A vertex whose
+distance later improves is scanned again, so each block is read a few times
+per search rather than once per vertex, and the queue holds at most one entry
+per block, whatever the number of edges.
+
+Construction streams the graph .txt file twice (same format as used by
+createGraph): once to count degrees, and once to distribute edges into
+partition files sized to the memory budget. Each partition is then sorted in
+memory and written out as blocks with large sequential writes.
+
+PUBLIC OPERATIONS:
+* shortestPaths(from, distance, previous)	Run Dijkstra's algorithm, filling
+															distance and previous arrays.
+* dijkstra(from)								Run Dijkstra's algorithm and output
+															all path information.
+* outputIOInformation()						Print I/O volume used so far.
+
+*/
+
+#ifndef ExternalGraph_h
+#define ExternalGraph_h
+
+#include <algorithm>
+#include <cstdio>
+#include <fcntl.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits.h>
+#include <list>
+#include <set>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include "binary_heap.h"
+using namespace std;
+
+class ExternalGraph {
+public:
+
+		// Constructor - partition a graph .txt file into on-disk blocks.
+		// @graph_filename	Valid filename of a .txt file containing graph
+		//							specifications: size, followed by a list of directed
+		//							edges.
+		// @block_filename	File in which to store the adjacency blocks; removed
+		//							when the ExternalGraph is destroyed.
+		// @memoryBytes		Memory budget (bytes) for partition sorting and for
+		//							the block buffer pool.
+		// @blocksInPool		Number of blocks the buffer pool should hold; blocks
+		//							are sized to memoryBytes / blocksInPool (a vertex
+		//							of higher degree gets a block of its own).
+		// Pre-Condition: 	Input contains properly formatted graph information.
+		//							Invalid edges are reported and skipped.
+		ExternalGraph(const string graph_filename, const string block_filename,
+						  const long memoryBytes = 64L << 20,
+						  const int blocksInPool = 16) :
+			block_filename_{block_filename}, block_fd_{-1},
+			number_of_vertices_{0},
+			memory_bytes_{memoryBytes > 0 ? memoryBytes : 1},
+			block_bytes_{max(4096L, memory_bytes_ / max(1, blocksInPool))},
+			pool_bytes_{0}, bytes_read_{0}, bytes_written_{0}, block_reads_{0},
+			pool_hits_{0}, vertex_scans_{0} {
+
+			partitionToBlocks(graph_filename);
+			pool_position_.assign(numberOfBlocks(), pool_.end());
+
+			block_fd_ = open(block_filename_.c_str(), O_RDONLY);
+			if(block_fd_ < 0) {
+				cout << "Cannot read from " << block_filename_ << endl;
+				exit(1);
+			}
+		}
+
+		// Destructor - close and remove the block file.
+		~ExternalGraph() {
+			if(block_fd_ >= 0) {
+				close(block_fd_);
+				unlink(block_filename_.c_str());
+			}
+		}
+
+		// Blocks are tied to a file on disk; ExternalGraphs are not copyable.
+		ExternalGraph(const ExternalGraph &) = delete;
+		ExternalGraph & operator=(const ExternalGraph &) = delete;
+
+		// @return		Number of vertices in the graph.
+		int numberOfVertices() const {
+			return number_of_vertices_;
+		}
+
+		// Run Dijkstra's algorithm from an origin vertex block by block: the
+		// block holding the closest vertex awaiting a scan is loaded through the
+		// buffer pool, and all of its waiting vertices are scanned.
+		// @from					Identity (integer) of an origin vertex.
+		// @distance			Filled with the distance of each vertex (indexed by
+		//							identity - 1); INT_MAX if unreachable.
+		// @previous			Filled with the index (identity - 1) of the prior
+		//							vertex on each path; -1 if none.
+		// Pre-Condition:		from is a valid vertex identity - this is checked.
+		void shortestPaths(const int from, vector<float> &distance,
+								 vector<int> &previous) {
+			distance.assign(number_of_vertices_, INT_MAX);
+			previous.assign(number_of_vertices_, -1);
+
+			if(from < 1 || from > number_of_vertices_) {
+				cout << "Invalid vertex selection! Please provide a selection "
+					  << "between 1 and " << number_of_vertices_ << endl << endl;
+				return;
+			}
+
+			// Vertices whose distance improved since they were last scanned, and
+			// the queue of blocks holding any, keyed by their closest one.
+			vector<bool> waiting(number_of_vertices_, false);
+			vector<float> blockKey(numberOfBlocks(), INT_MAX);
+			set<pair<float, int>> blocks;
+
+			auto wait = [&](const int w) {
+				const int b = blockOf(w);
+				waiting[w] = true;
+
+				if(distance[w] < blockKey[b]) {
+					blocks.erase(make_pair(blockKey[b], b));
+					blockKey[b] = distance[w];
+					blocks.insert(make_pair(blockKey[b], b));
+				}
+			};
+
+			distance[from - 1] = 0.0;
+			wait(from - 1);
+
+			while(!blocks.empty()) {
+				const int b = blocks.begin()->second;
+				blocks.erase(blocks.begin());
+				blockKey[b] = INT_MAX;
+
+				const Block &block = loadBlock(b);
+				const int blockEnd = block_first_vertex_[b + 1];
+
+				// Scan the block's waiting vertices in order of distance; edges
+				// within the block are followed while it is resident.
+				BinaryHeap<QueueEntry> queue;
+				for(int v = block.first_vertex_; v < blockEnd; v++) {
+					if(waiting[v]) {
+						queue.insert(QueueEntry(distance[v], v));
+					}
+				}
+
+				while(!queue.isEmpty()) {
+					const QueueEntry entry = queue.findMin();
+					queue.deleteMin();
+
+					const int v = entry.vertex_;
+					if(!waiting[v] || entry.distance_ > distance[v]) {
+						continue;
+					}
+
+					waiting[v] = false;
+					vertex_scans_++;
+
+					const int local = v - block.first_vertex_;
+					for(int i = block.offsets_[local]; i < block.offsets_[local + 1];
+						 i++) {
+						const int w = block.targets_[i];
+
+						if(distance[v] + block.weights_[i] < distance[w]) {
+							distance[w] = distance[v] + block.weights_[i];
+							previous[w] = v;
+
+							if(w >= block.first_vertex_ && w < blockEnd) {
+								waiting[w] = true;
+								queue.insert(QueueEntry(distance[w], w));
+							}
+							else {
+								wait(w);
+							}
+						}
+					}
+				}
+			}
+		}
+
+		// Run Dijkstra's algorithm and output all path information, in the same
+		// format as Graph::dijkstra.
+		// @from					Identity (integer) of an origin vertex.
+		void dijkstra(const int from) {
+			if(from < 1 || from > number_of_vertices_) {
+				cout << "Invalid vertex selection! Please provide a selection "
+					  << "between 1 and " << number_of_vertices_ << endl << endl;
+				return;
+			}
+
+			vector<float> distance;
+			vector<int> previous;
+			shortestPaths(from, distance, previous);
+
+			vector<int> path;
+			for(int i = 0; i < number_of_vertices_; i++) {
+				path.clear();
+				for(int v = i; v != -1; v = previous[v]) {
+					path.push_back(v + 1);
+				}
+
+				cout << i + 1 << ": ";
+				for(size_t j = path.size(); j > 0; j--) {
+					cout << path[j - 1] << (j > 1 ? ", " : "");
+				}
+				cout << ", Cost: " << fixed << setprecision(1) << distance[i];
+				cout << endl;
+			}
+		}
+
+		// Utility for printing the I/O volume used by this instance: bytes
+		// written while partitioning, bytes read while querying, block reads
+		// versus buffer pool hits, and vertex scans (including repeat scans).
+		void outputIOInformation() const {
+			cout << "Blocks: " << numberOfBlocks() << " (up to " << block_bytes_
+				  << " bytes per block)" << endl;
+			cout << "Bytes Written: " << bytes_written_ << endl;
+			cout << "Bytes Read: " << bytes_read_ << endl;
+			cout << "Block Reads: " << block_reads_ << endl;
+			cout << "Buffer Pool Hits: " << pool_hits_ << endl;
+			cout << "Vertex Scans: " << vertex_scans_ << endl << endl;
+		}
+
+private:
+
+	// PRIVATE STRUCT - BLOCK (adjacency of consecutive vertices, CSR layout)
+	struct Block {
+		int index_;
+		int first_vertex_;
+		vector<int> offsets_;
+		vector<int> targets_;
+		vector<float> weights_;
+
+		// @return		Resident size (bytes) of the block.
+		long bytes() const {
+			return static_cast<long>(offsets_.size() + targets_.size()) *
+				sizeof(int) + static_cast<long>(weights_.size()) * sizeof(float);
+		}
+	};
+
+	// PRIVATE STRUCT - QUEUEENTRY (vertex index keyed by tentative distance)
+	struct QueueEntry {
+		float distance_;
+		int vertex_;
+
+		QueueEntry(float distance = 0.0, int vertex = 0) :
+			distance_{distance}, vertex_{vertex} { }
+
+		bool operator<(const QueueEntry & rhs) const {
+			return distance_ < rhs.distance_;
+		}
+	};
+
+	string block_filename_;
+	int block_fd_;
+	int number_of_vertices_;
+	long memory_bytes_;
+	long block_bytes_;		// Target size of a block.
+
+	// Block index: byte offset of each block in the block file, and first
+	// vertex of each block (each plus end).
+	vector<long> block_offsets_;
+	vector<int> block_first_vertex_;
+
+	// Buffer pool: resident blocks in least- to most-recently used order.
+	list<Block> pool_;
+	vector<list<Block>::iterator> pool_position_; // pool_.end() if not resident
+	long pool_bytes_;
+
+	// I/O accounting
+	long bytes_read_;
+	long bytes_written_;
+	long block_reads_;
+	long pool_hits_;
+	long vertex_scans_;
+
+
+	/*
+	*****************************************************************************
+	****************************PRIVATE FUNCTIONS********************************
+	*****************************************************************************
+	*/
+
+	// @return		Number of blocks.
+	int numberOfBlocks() const {
+		return static_cast<int>(block_first_vertex_.size()) - 1;
+	}
+
+	// @return		Index of the block holding a vertex index.
+	int blockOf(const int vertex) const {
+		return static_cast<int>(upper_bound(block_first_vertex_.begin(),
+			block_first_vertex_.end(), vertex) - block_first_vertex_.begin()) - 1;
+	}
+
+	// Read the number of vertices (first line) of a graph .txt file.
+	// @graph_filename	Valid filename of a graph .txt file.
+	// @return				Number of vertices declared in the file.
+	int readGraphSize(const string graph_filename) {
+		ifstream graphInput(graph_filename);
+
+		if(graphInput.fail()) {
+			cout << "Cannot read from " << graph_filename;
+			exit(1);
+		}
+
+		int size(0);
+		graphInput >> size;
+		return size;
+	}
+
+	// Stream every edge of a graph .txt file.
+	// @graph_filename	Valid filename of a graph .txt file.
+	// @f						Called as f(from, to, weight) with 0-based vertex
+	//							indices for every valid edge that is not a self-loop.
+	// @reportInvalid		Whether to output a message for invalid edges.
+	template <typename Function>
+	void forEachInputEdge(const string graph_filename, Function f,
+								bool reportInvalid) {
+		ifstream graphInput(graph_filename);
+
+		if(graphInput.fail()) {
+			cout << "Cannot read from " << graph_filename;
+			exit(1);
+		}
+
+		int size(0), originVertex(0), targetVertex(0);
+		float edgeWeight(0.0);
+		string line;
+		stringstream sLine;
+
+		getline(graphInput, line);
+		sLine.str(line);
+		sLine >> size;
+
+		while(getline(graphInput, line)) {
+			sLine.clear();
+			sLine.str(line);
+
+			sLine >> originVertex;
+
+			while(sLine >> targetVertex) {
+				sLine >> edgeWeight;
+
+				if(originVertex < 1 || originVertex > size || targetVertex < 1 ||
+					targetVertex > size || edgeWeight < 0.0) {
+					if(reportInvalid) {
+						cout << "Invalid input! Please provide vertex selections "
+							  << "between 1 and " << size << " and positive edge "
+							  << "edge weight." << endl << endl;
+					}
+					continue;
+				}
+
+				if(originVertex != targetVertex) {
+					f(originVertex - 1, targetVertex - 1, edgeWeight);
+				}
+			}
+		}
+	}
+
+	// Build the block file from a graph .txt file. Degrees are counted first
+	// so that blocks can be sized in bytes and partitions (ranges of whole
+	// blocks) to the memory budget; edges are then distributed to one file per
+	// partition, and each partition is sorted in memory and written as blocks.
+	// Duplicate edges are dropped (the first one read wins), matching
+	// Graph::addEdge.
+	void partitionToBlocks(const string graph_filename) {
+		number_of_vertices_ = readGraphSize(graph_filename);
+
+		vector<long> degrees(number_of_vertices_, 0);
+		forEachInputEdge(graph_filename,
+			[&](int from, int, float) { degrees[from]++; }, true);
+
+		// Cut a new block wherever the next vertex would take the current one
+		// past the target size.
+		const long edgeBytes = sizeof(int) + sizeof(float);
+		long blockBytes = 0;
+		block_first_vertex_.assign(1, 0);
+
+		for(int v = 0; v < number_of_vertices_; v++) {
+			const long vertexBytes = sizeof(int) + degrees[v] * edgeBytes;
+
+			if(blockBytes > 0 && blockBytes + vertexBytes > block_bytes_) {
+				block_first_vertex_.push_back(v);
+				blockBytes = 0;
+			}
+			blockBytes += vertexBytes;
+		}
+		block_first_vertex_.push_back(number_of_vertices_);
+
+		const int numberOfBlocks = this->numberOfBlocks();
+
+		// Choose partition boundaries (in blocks) so that each partition's
+		// edges fit within half of the memory budget. The number of partition
+		// files is capped to stay well within open file limits.
+		const int maxPartitions = 256;
+		long partitionBudget = max(memory_bytes_ / 2, edgeBytes);
+		vector<int> partitionFirstBlock;
+
+		while(true) {
+			partitionFirstBlock.assign(1, 0);
+			long partitionEdges = 0;
+
+			for(int b = 0; b < numberOfBlocks; b++) {
+				long blockEdges = 0;
+				for(int v = block_first_vertex_[b]; v < block_first_vertex_[b + 1];
+					 v++) {
+					blockEdges += degrees[v];
+				}
+
+				if(partitionEdges > 0 &&
+					(partitionEdges + blockEdges) * edgeBytes > partitionBudget) {
+					partitionFirstBlock.push_back(b);
+					partitionEdges = 0;
+				}
+				partitionEdges += blockEdges;
+			}
+
+			if(static_cast<int>(partitionFirstBlock.size()) <= maxPartitions) {
+				break;
+			}
+			partitionBudget *= 2;
+		}
+		partitionFirstBlock.push_back(numberOfBlocks);
+
+		const int numberOfPartitions =
+			static_cast<int>(partitionFirstBlock.size()) - 1;
+
+		// Map each block to its partition, then distribute edges.
+		vector<int> partitionOfBlock(numberOfBlocks);
+		for(int p = 0; p < numberOfPartitions; p++) {
+			for(int b = partitionFirstBlock[p]; b < partitionFirstBlock[p + 1];
+				 b++) {
+				partitionOfBlock[b] = p;
+			}
+		}
+
+		vector<ofstream> partitionOutput(numberOfPartitions);
+		for(int p = 0; p < numberOfPartitions; p++) {
+			partitionOutput[p].open(partitionFilename(p), ios::binary);
+			if(partitionOutput[p].fail()) {
+				cout << "Cannot write to " << partitionFilename(p) << endl;
+				exit(1);
+			}
+		}
+
+		forEachInputEdge(graph_filename, [&](int from, int to, float weight) {
+			ofstream &out = partitionOutput[partitionOfBlock[blockOf(from)]];
+			out.write(reinterpret_cast<const char *>(&from), sizeof(int));
+			out.write(reinterpret_cast<const char *>(&to), sizeof(int));
+			out.write(reinterpret_cast<const char *>(&weight), sizeof(float));
+			bytes_written_ += 2 * sizeof(int) + sizeof(float);
+		}, false);
+
+		partitionOutput.clear();
+
+		// Sort each partition by origin vertex and write its blocks.
+		ofstream blockOutput(block_filename_, ios::binary);
+		if(blockOutput.fail()) {
+			cout << "Cannot write to " << block_filename_ << endl;
+			exit(1);
+		}
+
+		block_offsets_.assign(1, 0);
+		vector<int> lastOrigin(number_of_vertices_, -1);
+
+		for(int p = 0; p < numberOfPartitions; p++) {
+			writePartitionBlocks(p, partitionFirstBlock[p],
+										partitionFirstBlock[p + 1], degrees, lastOrigin,
+										blockOutput);
+		}
+	}
+
+	// Load one partition file, counting-sort it by origin vertex and append its
+	// blocks to the block file.
+	void writePartitionBlocks(const int partition, const int firstBlock,
+									  const int endBlock, const vector<long> &degrees,
+									  vector<int> &lastOrigin, ofstream &blockOutput) {
+		const int firstVertex = block_first_vertex_[firstBlock];
+		const int endVertex = block_first_vertex_[endBlock];
+
+		vector<long> next(endVertex - firstVertex + 1, 0);
+		for(int v = firstVertex; v < endVertex; v++) {
+			next[v - firstVertex + 1] = next[v - firstVertex] + degrees[v];
+		}
+		const vector<long> start(next);
+
+		vector<int> targets(next.back());
+		vector<float> weights(next.back());
+
+		ifstream partitionInput(partitionFilename(partition), ios::binary);
+		int edge[2];
+		float weight;
+
+		while(partitionInput.read(reinterpret_cast<char *>(edge), sizeof(edge)) &&
+				partitionInput.read(reinterpret_cast<char *>(&weight),
+										  sizeof(float))) {
+			const long slot = next[edge[0] - firstVertex]++;
+			targets[slot] = edge[1];
+			weights[slot] = weight;
+		}
+
+		partitionInput.close();
+		remove(partitionFilename(partition).c_str());
+
+		for(int b = firstBlock; b < endBlock; b++) {
+			const int blockFirst = block_first_vertex_[b];
+			const int blockEnd = block_first_vertex_[b + 1];
+			vector<int> offsets(1, 0);
+			vector<int> blockTargets;
+			vector<float> blockWeights;
+
+			for(int v = blockFirst; v < blockEnd; v++) {
+				for(long i = start[v - firstVertex]; i < start[v - firstVertex + 1];
+					 i++) {
+					if(lastOrigin[targets[i]] != v) {
+						lastOrigin[targets[i]] = v;
+						blockTargets.push_back(targets[i]);
+						blockWeights.push_back(weights[i]);
+					}
+				}
+				offsets.push_back(static_cast<int>(blockTargets.size()));
+			}
+
+			writeVector(blockOutput, offsets);
+			writeVector(blockOutput, blockTargets);
+			writeVector(blockOutput, blockWeights);
+
+			block_offsets_.push_back(block_offsets_.back() +
+				static_cast<long>(offsets.size() + blockTargets.size()) *
+				sizeof(int) + static_cast<long>(blockWeights.size()) *
+				sizeof(float));
+		}
+	}
+
+	// Fetch a block through the buffer pool, reading it from disk (evicting
+	// least recently used blocks beyond the memory budget) on a miss.
+	// @index		Index of the block.
+	// @return		Reference to the resident block; valid until the next call.
+	const Block & loadBlock(const int index) {
+		if(pool_position_[index] != pool_.end()) {
+			pool_.splice(pool_.end(), pool_, pool_position_[index]);
+			pool_hits_++;
+			return pool_.back();
+		}
+
+		Block block;
+		block.index_ = index;
+		block.first_vertex_ = block_first_vertex_[index];
+		const int blockVertices = block_first_vertex_[index + 1] -
+			block.first_vertex_;
+
+		long position = block_offsets_[index];
+		block.offsets_.resize(blockVertices + 1);
+		readVector(block.offsets_, position);
+		block.targets_.resize(block.offsets_.back());
+		readVector(block.targets_, position);
+		block.weights_.resize(block.offsets_.back());
+		readVector(block.weights_, position);
+		block_reads_++;
+
+		// Evict until the new block fits (always keep at least the new block).
+		while(!pool_.empty() && pool_bytes_ + block.bytes() > memory_bytes_) {
+			pool_bytes_ -= pool_.front().bytes();
+			pool_position_[pool_.front().index_] = pool_.end();
+			pool_.pop_front();
+		}
+
+		pool_bytes_ += block.bytes();
+		pool_.push_back(std::move(block));
+		pool_position_[index] = --pool_.end();
+		return pool_.back();
+	}
+
+	// Append a vector to a binary output stream.
+	template <typename T>
+	void writeVector(ofstream &out, const vector<T> &values) {
+		out.write(reinterpret_cast<const char *>(values.data()),
+					 values.size() * sizeof(T));
+		bytes_written_ += values.size() * sizeof(T);
+	}
+
+	// Read a (pre-sized) vector from the block file at position, advancing
+	// position past it.
+	template <typename T>
+	void readVector(vector<T> &values, long &position) {
+		const long size = values.size() * sizeof(T);
+		long done = 0;
+
+		while(done < size) {
+			const ssize_t got = pread(block_fd_,
+				reinterpret_cast<char *>(values.data()) + done, size - done,
+				position + done);
+			if(got <= 0) {
+				cout << "Cannot read from " << block_filename_ << endl;
+				exit(1);
+			}
+			done += got;
+		}
+
+		position += size;
+		bytes_read_ += size;
+	}
+
+	// @return		Name of the temporary file for a partition.
+	string partitionFilename(const int partition) const {
+		return block_filename_ + ".part" + to_string(partition);
+	}
+
+};
+
+#endif /* ExternalGraph_h */
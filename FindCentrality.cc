@@ -0,0 +1,37 @@
+/*
+File Name: FindCentrality.cc
+Date Begun: 10/18/2026
+
+This file contains the routine for computing the betweenness, closeness and
+harmonic centrality of every vertex of a graph, exactly or from a sample of
+source vertices, and outputting them one vertex per line.
+
+*/
+
+#include <iostream>
+#include <string>
+#include "Centrality.h"
+#include "Graph.h"
+#include "GraphFiles.h"
+using namespace std;
+
+int main(int argc, char**argv) {
+	if(argc != 2 && argc != 3) {
+		cout << "Usage: " << argv[0] << " <graphtxtfilename> [#ofSamples]"
+			  << endl << endl;
+		
+		return 0;
+	}
+	
+	const string graph_filename(argv[1]);
+	const int samples(argc == 3 ? stoi(argv[2], nullptr) : 0);
+	
+	// Create Graph
+	const Graph testGraph = createGraph(graph_filename);
+	
+	// Compute and output centrality of every vertex
+	Centrality centrality(testGraph);
+	centrality.outputCentrality(samples);
+
+	return 0;
+}
@@ -0,0 +1,61 @@
+/*
+File Name: FindFacilities.cc
+Date Begun: 10/18/2026
+
+This file contains the routine for finding, for every vertex of a graph, the
+nearest of a set of facility vertices: the path from the vertex to that
+facility and its cost are output, in the same form as FindPaths. All
+facilities are handled by a single multi-source run of Dijkstra's algorithm
+(on the reversed graph, so that costs are measured toward the facilities).
+
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Graph.h"
+#include "GraphFiles.h"
+using namespace std;
+
+int main(int argc, char**argv) {
+	if(argc < 3) {
+		cout << "Usage: " << argv[0] << " <graphtxtfilename> <#ofFacilityVertex>"
+			  << " [<#ofFacilityVertex> ...]" << endl << endl;
+		
+		return 0;
+	}
+	
+	const string graph_filename(argv[1]);
+	vector<int> facilities;
+	for(int i = 2; i < argc; i++) {
+		facilities.push_back(stoi(argv[i], nullptr));
+	}
+	
+	// Create Graph, reversed so that paths lead toward the facilities
+	const Graph reversedGraph = createGraph(graph_filename).reversed();
+	
+	// Label every vertex with its nearest facility
+	const Graph::FacilityPartition partition =
+		reversedGraph.nearestFacilities(facilities);
+	
+	// Output results
+	for(int i = 0; i < reversedGraph.numberOfVertices(); i++) {
+		cout << i + 1 << ": ";
+		
+		if(partition.facility_[i] == 0) {
+			cout << "No facility reachable" << endl;
+			continue;
+		}
+		
+		// Prior vertices in the reversed graph are next vertices toward the
+		// facility in the original graph.
+		for(int v = i; v != -1; v = partition.previous_[v]) {
+			cout << v + 1 << (partition.previous_[v] != -1 ? ", " : "");
+		}
+		cout << ", Facility: " << partition.facility_[i] << ", Cost: " << fixed
+			  << setprecision(1) << partition.distance_[i] << endl;
+	}
+
+	return 0;
+}
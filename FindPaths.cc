@@ -5,7 +5,9 @@ Date Begun: 4/18/2019
 
 This file contains the routine for testing use of Dijkstra's Algorithm on the
 Graph class to output the shortest paths from a given starting vertex to all
-vertices in the graph.
+vertices in the graph (optionally using only edges up to a maximum weight)
+or, given a target vertex and k, the k shortest simple paths from the starting
+vertex to the target.
 
 */
 
@@ -14,73 +16,16 @@ vertices in the graph.
 #include <sstream>
 #include <string>
 #include "Graph.h"
+#include "GraphFiles.h"
+#include "GraphView.h"
+#include "KShortestPaths.h"
 using namespace std;
 
-// Utility function for opening input/query files.
-// @filename	Valid filename of a .txt file.
-// @return		Returns an input file stream if properly initialized; else
-//					exits with error code 1.
-ifstream openFile(const string filename) {
-	ifstream input;
-	
-	// Open input file
-	input.open(filename);
-	
-	// Check for failure to open input file
-	if(input.fail()) {
-		cout << "Cannot read from " << filename;
-		exit(1);
-	}
-	
-	return input;
-}
-
-// Function for generating a graph based on .txt input file specifications.
-// @graph_filename	Valid filename of a .txt file containing graph
-//							specifications: size, followed by a list of directed edges.
-// @return				Returns a Graph initialized as specified in the .txt file.
-// Pre-Condition: 	Input contains properly formatted graph information. This
-//							pre-condition is NOT checked. 
-Graph createGraph(const string graph_filename) {
-	// Open graph input file
-	ifstream graphInput = openFile(graph_filename);
-	
-	int size(0), originVertex(0), targetVertex(0);
-	float edgeWeight(0.0);
-	
-	string line;
-	stringstream sLine;
-	
-	// Read in size and initialize Graph
-	getline(graphInput, line);
-	sLine.str(line);
-	sLine >> size;
-	Graph newGraph(size);
-	
-	// Read in directed edges and construct Graph
-	while(getline(graphInput, line)) {
-		sLine.clear();
-		sLine.str(line);
-		
-		sLine >> originVertex;
-		
-		while(sLine >> targetVertex) {
-			sLine >> edgeWeight;
-			
-			newGraph.addEdge(originVertex, targetVertex, edgeWeight);
-		}
-	}
-	
-	//Close file
-	graphInput.close();
-	
-	return newGraph;
-}
-
 int main(int argc, char**argv) {
-	if(argc != 3) {
+	if(argc < 3 || argc > 5) {
 		cout << "Usage: " << argv[0] << " <graphtxtfilename> <#ofStartingVertex>"
-			  << endl << endl;
+			  << " [<maxEdgeWeight> | <#ofTargetVertex> <#ofPaths>]" << endl
+			  << endl;
 		
 		return 0;
 	}
@@ -91,8 +36,21 @@ int main(int argc, char**argv) {
 	// Create Graph
 	Graph testGraph = createGraph(graph_filename);
 	
-	// Run Dijkstra's Algorithm on testGraph
-	testGraph.dijkstra(startVertex);
+	// Run Dijkstra's Algorithm on testGraph (or on a view of it without heavier
+	// edges), or Yen's algorithm for the k shortest paths to a target
+	if(argc == 5) {
+		KShortestPaths kPaths(testGraph);
+		kPaths.outputPaths(startVertex, stoi(argv[3], nullptr),
+								 stoi(argv[4], nullptr));
+	}
+	else if(argc == 4) {
+		const GraphView view = GraphView(Graph::share(std::move(testGraph)))
+			.withWeights(0.0, stof(argv[3], nullptr));
+		view.dijkstra(startVertex);
+	}
+	else {
+		testGraph.dijkstra(startVertex);
+	}
 
 	return 0;
 }
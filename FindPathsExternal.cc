@@ -0,0 +1,38 @@
+/*
+File Name: FindPathsExternal.cc
+Date Begun: 10/18/2026
+
+This file contains the routine for running Dijkstra's Algorithm out-of-core,
+on an ExternalGraph partitioned into on-disk blocks, to output the shortest
+paths from a given starting vertex to all vertices in the graph (in the same
+format as FindPaths), followed by the I/O volume used.
+
+*/
+
+#include <iostream>
+#include <string>
+#include "ExternalGraph.h"
+using namespace std;
+
+int main(int argc, char**argv) {
+	if(argc != 3 && argc != 4) {
+		cout << "Usage: " << argv[0] << " <graphtxtfilename> <#ofStartingVertex>"
+			  << " [memoryMegabytes]" << endl << endl;
+		
+		return 0;
+	}
+	
+	const string graph_filename(argv[1]);
+	const int startVertex(stoi(argv[2], nullptr));
+	const long memoryBytes(argc == 4 ? stol(argv[3], nullptr) << 20 : 64L << 20);
+	
+	// Partition Graph into on-disk blocks
+	ExternalGraph testGraph(graph_filename, graph_filename + ".blocks",
+									memoryBytes);
+	
+	// Run Dijkstra's Algorithm on testGraph and report I/O volume
+	testGraph.dijkstra(startVertex);
+	testGraph.outputIOInformation();
+
+	return 0;
+}
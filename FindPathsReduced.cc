@@ -0,0 +1,39 @@
+/*
+File Name: FindPathsReduced.cc
+Date Begun: 10/18/2026
+
+This file contains the routine for running Dijkstra's Algorithm on a
+ReducedGraph, which prunes dangling trees and contracts chains of the graph
+into a smaller core graph, to output the shortest paths from a given starting
+vertex to all vertices in the graph (in the same format as FindPaths),
+followed by how far the graph was reduced.
+
+*/
+
+#include <iostream>
+#include <string>
+#include "Graph.h"
+#include "GraphFiles.h"
+#include "ReducedGraph.h"
+using namespace std;
+
+int main(int argc, char**argv) {
+	if(argc != 3) {
+		cout << "Usage: " << argv[0] << " <graphtxtfilename> <#ofStartingVertex>"
+			  << endl << endl;
+		
+		return 0;
+	}
+	
+	const string graph_filename(argv[1]);
+	const int startVertex(stoi(argv[2], nullptr));
+	
+	// Create and reduce Graph
+	ReducedGraph testGraph(createGraph(graph_filename));
+	
+	// Run Dijkstra's Algorithm on the core of testGraph and report reduction
+	testGraph.dijkstra(startVertex);
+	testGraph.outputReductionInformation();
+
+	return 0;
+}
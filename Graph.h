@@ -12,12 +12,55 @@ compilation) of the Graph class, which employs a private Vertex structure.
 
 PUBLIC OPERATIONS:
 * addEdge(from, to, edge weight)		Add a (directed) edge to the graph.
+* removeEdge(from, to)					Remove a (directed) edge from the graph.
+* updateWeight(from, to, edge weight)	Change the weight of an existing edge.
+* compact()									Reclaim the entries of removed edges.
 * isConnected(from, to)					Check if two vertices are connected.
 * dijkstra()								Run Dijkstra's algorithm and output all
 												path information.
+* shortestPaths(from, distance, previous[, to[, allowed]])
+												Run Dijkstra's algorithm into caller-owned
+												arrays (safe for concurrent callers),
+												optionally stopping at a target and
+												masking edges with a filter.
+* search(from, state, allowed, visit)
+												Incremental Dijkstra search with sparse
+												state reset and early termination.
+* withinRadius(from, radius, state)	Vertices within a distance of a vertex.
+* nearest(from, k, state)				The k vertices nearest a vertex.
+* nearestFacilities(facilities)		Label every vertex with its nearest
+												facility in one multi-source search.
+* reversed()								Return the Graph with all edges reversed.
+* getDegreeInformation()				Return all degree information of the graph.
 * outputDegreeInformation()			Print all degree information of the graph:
 												number of edges, smallest degree, largest
 												degree, and average degree.
+* numberOfVertices()					Return the number of vertices.
+* share(graph)								Move a Graph into a shared, read-only Handle.
+
+Adjacency and paths are stored as vertex indices rather than pointers, so a
+Graph can be copied (deeply) or moved (in O(1)) safely. Each vertex's targets
+and weights are runs within large edge blocks owned by the Graph, not heap
+arrays of its own; Graphs built in bulk (and compacted or copied Graphs) hold
+every run back to back, in vertex order, in one block (a CSR layout), so
+destroying a Graph releases a few blocks rather than two arrays per vertex.
+Blocks are reference counted so that ConcurrentGraph (see ConcurrentGraph.h)
+can derive each merged Graph from the last one, sharing the runs of every
+vertex the merge did not change instead of copying them.
+To use one loaded Graph
+from several components without copying it, share() it as a Handle; GraphView
+(see GraphView.h) runs queries on filtered views of one without copying it.
+
+Graphs loaded in bulk should be constructed through GraphBuilder (see
+GraphBuilder.h), which stages edges and fills all adjacency in one pass, or
+loaded from a .txt file in parallel through GraphLoader (see GraphLoader.h).
+For repeated shortest-path queries, a Graph can be reduced to a smaller core
+graph by pruning dangling trees and contracting chains (see ReducedGraph.h).
+Betweenness, closeness and harmonic centrality are computed in parallel by
+Centrality (see Centrality.h).
+Reachability between any two vertices is answered from an index by
+ReachabilityIndex (see ReachabilityIndex.h), and full degree and weight
+statistics are computed in parallel by GraphStatistics (see GraphStatistics.h).
 
 */
 
@@ -25,10 +68,11 @@ PUBLIC OPERATIONS:
 #define Graph_h
 
 #include <iostream>
+#include <algorithm>
 #include <vector>
-#include <list>
 #include <limits.h>
 #include <iomanip>
+#include <memory>
 #include "binary_heap.h"
 using namespace std;
 
@@ -38,7 +82,10 @@ public:
 		// Constructor
 		// @size 	Number of vertices to be created in the Graph.
 		Graph(const int size = 10) : graph_vertices_(size),
-											  number_of_vertices_{size} {
+											  number_of_vertices_{size}, dead_edges_{0},
+											  self_loops_{0}, duplicate_edges_{0},
+											  block_used_{0}, block_capacity_{0},
+											  packed_offsets_(max(0, size) + 1, 0) {
 			
 			// Set all proper/intuitive identities (NOT counting from 0).
 			for(int i = 0; i < size; i++) {
@@ -46,6 +93,56 @@ public:
 			}
 		}
 	
+		// Copy Constructor - a deep copy, sharing nothing with the original;
+		// its live edges are packed into one block of its own (removed edges
+		// are not copied).
+		Graph(const Graph &rhs) : graph_vertices_(rhs.graph_vertices_),
+			number_of_vertices_{rhs.number_of_vertices_},
+			dead_edges_{rhs.dead_edges_}, self_loops_{rhs.self_loops_},
+			duplicate_edges_{rhs.duplicate_edges_}, block_used_{0},
+			block_capacity_{0} {
+			pack();
+		}
+	
+		// Copy Assignment - as for the copy constructor.
+		Graph &operator=(const Graph &rhs) {
+			if(this != &rhs) {
+				*this = Graph(rhs);
+			}
+			return *this;
+		}
+	
+		// Move Constructor - O(1); rhs is left empty.
+		Graph(Graph &&rhs) noexcept :
+			graph_vertices_(std::move(rhs.graph_vertices_)),
+			number_of_vertices_{rhs.number_of_vertices_},
+			dead_edges_{rhs.dead_edges_}, self_loops_{rhs.self_loops_},
+			duplicate_edges_{rhs.duplicate_edges_},
+			target_blocks_(std::move(rhs.target_blocks_)),
+			weight_blocks_(std::move(rhs.weight_blocks_)),
+			block_used_{rhs.block_used_}, block_capacity_{rhs.block_capacity_},
+			packed_offsets_(std::move(rhs.packed_offsets_)) {
+			rhs.clearAll();
+		}
+	
+		// Move Assignment - O(1); rhs is left empty.
+		Graph &operator=(Graph &&rhs) noexcept {
+			if(this != &rhs) {
+				graph_vertices_ = std::move(rhs.graph_vertices_);
+				number_of_vertices_ = rhs.number_of_vertices_;
+				dead_edges_ = rhs.dead_edges_;
+				self_loops_ = rhs.self_loops_;
+				duplicate_edges_ = rhs.duplicate_edges_;
+				target_blocks_ = std::move(rhs.target_blocks_);
+				weight_blocks_ = std::move(rhs.weight_blocks_);
+				block_used_ = rhs.block_used_;
+				block_capacity_ = rhs.block_capacity_;
+				packed_offsets_ = std::move(rhs.packed_offsets_);
+				rhs.clearAll();
+			}
+			return *this;
+		}
+	
 		// Add a directed edge between two vertices.
 		// @from					Identity (integer) of the origin vertex.
 		// @to					Identity (integer) of the target vertex.
@@ -65,25 +162,121 @@ public:
 				return;
 			}
 			
-			// Check if an edge already exists
-			if(isConnected(from, to) != -1.0 || from == to) {
+			// Drop self-loops and edges that already exist (counting both).
+			if(from == to) {
+				self_loops_++;
+				return;
+			}
+			
+			const int position = findEdge(from - 1, to - 1);
+			
+			if(position != -1 &&
+				graph_vertices_[from - 1].edge_weights_[position] >= 0.0) {
+				duplicate_edges_++;
+				return;
+			}
+			
+			// Revive a removed edge in place
+			if(position != -1) {
+				graph_vertices_[from - 1].edge_weights_[position] = edgeWeight;
+				graph_vertices_[from - 1].dead_edges_--;
+				dead_edges_--;
 				return;
 			}
 			
 			// Add edge properties to origin vertex - target and weight.
-			graph_vertices_[from - 1].adjacent_vertices_.push_back(&(graph_vertices_[to-1]));
-			graph_vertices_[from - 1].edge_weights_.push_back(edgeWeight);
+			appendEdge(graph_vertices_[from - 1], to - 1, edgeWeight);
 		
 		}
 	
+		// Remove a directed edge between two vertices. The edge is marked with a
+		// tombstone (a negative weight) rather than erased, so removal costs no
+		// more than a lookup; searches skip tombstoned edges. A vertex whose
+		// tombstones outnumber its live edges is compacted straight away, and
+		// compact() reclaims all remaining tombstones.
+		// @from					Identity (integer) of the origin vertex.
+		// @to					Identity (integer) of the target vertex.
+		// @return				True if the edge existed and has been removed.
+		// Pre-Condition:		from and to are valid vertex identities (integers).
+		//							This is checked in the function.
+		bool removeEdge(const int from, const int to) {
+			// Check valid input
+			if(!isValidVertex(from) || !isValidVertex(to)) {
+				cout << "Invalid vertex selections! Please provide selections "
+					  << "between 1 and " << number_of_vertices_ << endl << endl;
+				return false;
+			}
+			
+			Vertex &opV = graph_vertices_[from - 1];
+			const int position = findEdge(from - 1, to - 1);
+			
+			if(position == -1 || opV.edge_weights_[position] < 0.0) {
+				return false;
+			}
+			
+			opV.edge_weights_[position] = -1.0;
+			opV.dead_edges_++;
+			dead_edges_++;
+			
+			if(2 * opV.dead_edges_ > static_cast<int>(opV.edge_weights_.size())) {
+				compactVertex(opV);
+			}
+			
+			return true;
+		}
+	
+		// Change the weight of an existing directed edge, in place.
+		// @from					Identity (integer) of the origin vertex.
+		// @to					Identity (integer) of the target vertex.
+		// @edgeWeight			The new non-negative weight (float) of the edge.
+		// @return				True if the edge exists and has been updated.
+		// Pre-Conditions:	from and to are valid vertex identities (integers)
+		//							and the edge weight is non-negative. These are
+		//							checked in the function.
+		bool updateWeight(const int from, const int to, float edgeWeight) {
+			// Check valid input
+			if(!isValidVertex(from) || !isValidVertex(to) || edgeWeight < 0.0) {
+				cout << "Invalid input! Please provide vertex selections between "
+					  << "1 and " << number_of_vertices_ << " and positive edge "
+					  << "edge weight." << endl << endl;
+				return false;
+			}
+			
+			const int position = findEdge(from - 1, to - 1);
+			
+			if(position == -1 ||
+				graph_vertices_[from - 1].edge_weights_[position] < 0.0) {
+				return false;
+			}
+			
+			graph_vertices_[from - 1].edge_weights_[position] = edgeWeight;
+			return true;
+		}
+	
+		// Compaction pass: erase every tombstoned (removed) edge, reclaiming its
+		// entry, and pack all edges back into one block, reclaiming the space
+		// left behind by vertices whose edges outgrew their runs. Live edges
+		// keep their order.
+		void compact() {
+			if(dead_edges_ > 0 || packed_offsets_.empty()) {
+				pack();
+			}
+		}
+	
+		// @return		Number of tombstoned edges awaiting compaction.
+		long numberOfDeadEdges() const {
+			return dead_edges_;
+		}
+	
 		// Check for existing edge/connection between two vertices.
 		// @from					Identity (integer) of origin vertex.
 		// @to					Identity (integer) of target vertex.
 		// @return				Weight (float) of existing edge; else sentinel value
-		//							of -1.0 to signal no existing edge.
+		//							of -1.0 to signal no existing edge (a removed edge's
+		//							tombstone carries this same value).
 		// Pre-Condition:		from and to are valid vertex identities (integers).
 		//							This is checked in the function.
-		float isConnected(const int from, const int to) {
+		float isConnected(const int from, const int to) const {
 			float weight = -1.0;
 			
 			// Check valid input
@@ -97,7 +290,7 @@ public:
 			auto it2 = graph_vertices_[from - 1].edge_weights_.begin();
 			
 			while(it != graph_vertices_[from - 1].adjacent_vertices_.end()) {
-				if((*it)->identity_ == to) {
+				if(graph_vertices_[*it].identity_ == to) {
 					weight = *it2;
 					break;
 				}
@@ -142,16 +335,388 @@ public:
 			}
 		}
 	
-		// Utility for printing degree information of Graph instance: number of
+		// Computes shortest paths from an origin vertex with Dijkstra's
+		// algorithm, writing results into caller-owned arrays rather than the
+		// Graph's vertices, so that any number of callers (e.g. threads) may run
+		// concurrently on the same Graph.
+		// @from					Identity (integer) of an origin vertex.
+		// @distance			Filled with the distance of each vertex (indexed by
+		//							identity - 1) from the origin; INT_MAX if unreachable.
+		// @previous			Filled with the index (identity - 1) of the prior
+		//							vertex on the path to each vertex; -1 if none.
+		// @to					Optional identity (integer) of a target vertex; when
+		//							given, the search stops once it is settled and only
+		//							its distance and path are final.
+		// Pre-Condition:		from (and to, if given) are valid vertex identities.
+		//							This is checked in the function.
+		void shortestPaths(const int from, vector<float> &distance,
+								 vector<int> &previous, const int to = 0) const {
+			shortestPaths(from, distance, previous, to,
+							  [](const int, const int, const float) { return true; });
+		}
+	
+		// As above, but only edges accepted by a filter are used, allowing edges
+		// and vertices to be masked out without copying the Graph.
+		// @allowed				Called as allowed(v, w, weight) with the indices
+		//							(identity - 1) of each edge's origin and target and
+		//							its weight; the edge is ignored unless it returns
+		//							true. GraphView (see GraphView.h) builds such filters
+		//							from vertex subsets, weight thresholds and masks.
+		template <typename EdgeFilter>
+		void shortestPaths(const int from, vector<float> &distance,
+								 vector<int> &previous, const int to,
+								 EdgeFilter allowed) const {
+			distance.assign(number_of_vertices_, INT_MAX);
+			previous.assign(number_of_vertices_, -1);
+			
+			// Check valid input
+			if(!isValidVertex(from) || (to != 0 && !isValidVertex(to))) {
+				cout << "Invalid vertex selections! Please provide selections "
+					  << "between 1 and " << number_of_vertices_ << endl << endl;
+				return;
+			}
+			
+			vector<bool> known(number_of_vertices_, false);
+			BinaryHeap<QueueEntry> queue;
+			
+			distance[from - 1] = 0.0;
+			queue.insert(QueueEntry(0.0, from - 1));
+			
+			// While there are vertices to process, select the closest unknown
+			// vertex (skipping stale duplicate entries) and relax its edges.
+			while(!queue.isEmpty()) {
+				const int v = queue.findMin().vertex_;
+				queue.deleteMin();
+				
+				if(known[v]) {
+					continue;
+				}
+				
+				known[v] = true;
+				
+				if(v == to - 1) {
+					break;
+				}
+				
+				const Vertex &opV = graph_vertices_[v];
+				
+				for(size_t i = 0; i < opV.adjacent_vertices_.size(); i++) {
+					const int w = opV.adjacent_vertices_[i];
+					
+					if(!known[w] && opV.edge_weights_[i] >= 0.0 &&
+						(distance[v] + opV.edge_weights_[i]) < distance[w] &&
+						allowed(v, w, opV.edge_weights_[i])) {
+						distance[w] = distance[v] + opV.edge_weights_[i];
+						previous[w] = v;
+						queue.insert(QueueEntry(distance[w], w));
+					}
+				}
+			}
+		}
+	
+		// PUBLIC CLASS - SEARCHSTATE
+		// Reusable, caller-owned workspace for search(). Entries are tagged with
+		// the generation (query number) that wrote them, so starting a new
+		// query resets the whole state in O(1) instead of O(V): only vertices
+		// actually touched by a query are ever written.
+		class SearchState {
+		public:
+			
+				// Constructor
+				// @size		Number of vertices of the Graph(s) to be searched.
+				explicit SearchState(const int size = 0) : generation_{0} {
+					resize(size);
+				}
+				
+				// @return	Distance of a vertex (by index, identity - 1) from the
+				//				origin of the last search; INT_MAX if not reached.
+				float distance(const int index) const {
+					return (reached_[index] == generation_) ? distance_[index] :
+						INT_MAX;
+				}
+				
+				// @return	Index of the prior vertex on the path to a vertex in the
+				//				last search; -1 if none (or not reached).
+				int previous(const int index) const {
+					return (reached_[index] == generation_) ? previous_[index] : -1;
+				}
+				
+		private:
+		
+			vector<float> distance_;
+			vector<int> previous_;
+			vector<unsigned> reached_;		// Generation in which distance was set.
+			vector<unsigned> settled_;		// Generation in which vertex was known.
+			unsigned generation_;
+			
+			// Grow the state to hold size vertices.
+			void resize(const int size) {
+				if(size > static_cast<int>(distance_.size())) {
+					distance_.resize(size);
+					previous_.resize(size);
+					reached_.resize(size, 0);
+					settled_.resize(size, 0);
+				}
+			}
+			
+			// Start a new search; stamps are only cleared when the generation
+			// counter wraps around.
+			void nextGeneration() {
+				if(++generation_ == 0) {
+					fill(reached_.begin(), reached_.end(), 0);
+					fill(settled_.begin(), settled_.end(), 0);
+					generation_ = 1;
+				}
+			}
+			
+			friend class Graph;
+		};
+	
+		// Incremental Dijkstra search from an origin vertex that settles vertices
+		// in order of distance, reporting each one to a visitor which may stop
+		// the search early. Only touched vertices are reset between searches
+		// (see SearchState), so a search costs time proportional to the region
+		// explored rather than to the size of the Graph.
+		// @from					Identity (integer) of an origin vertex.
+		// @state				Workspace to search in; afterwards holds the distance
+		//							and path of every vertex reached.
+		// @allowed				Edge filter, as for shortestPaths.
+		// @visit				Called as visit(index, distance) as each vertex
+		//							(including the origin) is settled; returning false
+		//							ends the search.
+		// Pre-Condition:		from is a valid vertex identity. This is checked in
+		//							the function.
+		template <typename EdgeFilter, typename Visitor>
+		void search(const int from, SearchState &state, EdgeFilter allowed,
+						Visitor visit) const {
+			search(vector<int>(1, from), state, allowed, visit);
+		}
+	
+		// As above, but from several origin vertices at once: every origin starts
+		// at distance 0, so each vertex is reached from its nearest origin.
+		// @origins				Identities (integers) of the origin vertices.
+		template <typename EdgeFilter, typename Visitor>
+		void search(const vector<int> &origins, SearchState &state,
+						EdgeFilter allowed, Visitor visit) const {
+			search(origins, state, allowed, visit, NoExtraEdges());
+		}
+	
+		// As above, but additionally following edges held outside the Graph
+		// (e.g. edges not yet merged into it), which are relaxed after each
+		// vertex's own edges. Extra edges are not passed through the filter.
+		// @extraEdges			Called as extraEdges(v, relax) for each settled vertex
+		//							index v; calls relax(w, weight) for each extra edge
+		//							from v to vertex index w.
+		template <typename EdgeFilter, typename Visitor, typename ExtraEdges>
+		void search(const vector<int> &origins, SearchState &state,
+						EdgeFilter allowed, Visitor visit,
+						ExtraEdges extraEdges) const {
+			state.resize(number_of_vertices_);
+			state.nextGeneration();
+			
+			// Check valid input
+			for(size_t i = 0; i < origins.size(); i++) {
+				if(!isValidVertex(origins[i])) {
+					cout << "Invalid vertex selection! Please provide a selection "
+						  << "between 1 and " << number_of_vertices_ << endl << endl;
+					return;
+				}
+			}
+			
+			const unsigned generation = state.generation_;
+			BinaryHeap<QueueEntry> queue;
+			
+			for(size_t i = 0; i < origins.size(); i++) {
+				const int origin = origins[i] - 1;
+				
+				if(state.reached_[origin] != generation) {
+					state.distance_[origin] = 0.0;
+					state.previous_[origin] = -1;
+					state.reached_[origin] = generation;
+					queue.insert(QueueEntry(0.0, origin));
+				}
+			}
+			
+			while(!queue.isEmpty()) {
+				const int v = queue.findMin().vertex_;
+				queue.deleteMin();
+				
+				if(state.settled_[v] == generation) {
+					continue;
+				}
+				
+				state.settled_[v] = generation;
+				
+				if(!visit(v, state.distance_[v])) {
+					break;
+				}
+				
+				const Vertex &opV = graph_vertices_[v];
+				auto relax = [&](const int w, const float weight) {
+					const float distanceW = state.distance_[v] + weight;
+					
+					if(state.settled_[w] != generation &&
+						(state.reached_[w] != generation ||
+						 distanceW < state.distance_[w])) {
+						state.distance_[w] = distanceW;
+						state.previous_[w] = v;
+						state.reached_[w] = generation;
+						queue.insert(QueueEntry(distanceW, w));
+					}
+				};
+				
+				// Own edges: skip tombstones and filtered edges.
+				for(size_t i = 0; i < opV.adjacent_vertices_.size(); i++) {
+					const int w = opV.adjacent_vertices_[i];
+					const float weight = opV.edge_weights_[i];
+					
+					if(weight >= 0.0 && allowed(v, w, weight)) {
+						relax(w, weight);
+					}
+				}
+				
+				extraEdges(v, relax);
+			}
+		}
+	
+		// Find all vertices within a distance of an origin vertex.
+		// @from					Identity (integer) of an origin vertex.
+		// @radius				Largest distance to include.
+		// @state				Workspace to search in (see SearchState).
+		// @return				(identity, distance) of every other vertex within
+		//							radius of the origin, in order of distance.
+		vector<pair<int, float>> withinRadius(const int from, const float radius,
+														  SearchState &state) const {
+			vector<pair<int, float>> found;
+			
+			search(from, state, [](const int, const int, const float) { return true; },
+					 [&](const int v, const float distance) {
+				if(distance > radius) {
+					return false;
+				}
+				if(v != from - 1) {
+					found.push_back(make_pair(v + 1, distance));
+				}
+				return true;
+			});
+			
+			return found;
+		}
+	
+		// Find the k vertices nearest to an origin vertex.
+		// @from					Identity (integer) of an origin vertex.
+		// @k						Number of vertices wanted.
+		// @state				Workspace to search in (see SearchState).
+		// @return				(identity, distance) of the (up to) k other vertices
+		//							nearest the origin, in order of distance.
+		vector<pair<int, float>> nearest(const int from, const int k,
+													SearchState &state) const {
+			vector<pair<int, float>> found;
+			
+			if(k <= 0) {
+				return found;
+			}
+			
+			search(from, state, [](const int, const int, const float) { return true; },
+					 [&](const int v, const float distance) {
+				if(v != from - 1) {
+					found.push_back(make_pair(v + 1, distance));
+				}
+				return static_cast<int>(found.size()) < k;
+			});
+			
+			return found;
+		}
+	
+		// PUBLIC STRUCT - FACILITYPARTITION (see nearestFacilities)
+		// All vectors are indexed by vertex index (identity - 1).
+		struct FacilityPartition {
+			vector<int> facility_;		// Nearest facility identity; 0 if none.
+			vector<float> distance_;	// Distance to it; INT_MAX if none.
+			vector<int> previous_;		// Prior vertex index on the path; -1 if
+												// none (or a facility itself).
+		};
+	
+		// Label every vertex with its nearest facility, in a single multi-source
+		// Dijkstra run seeded with all facilities at distance 0 (rather than one
+		// run per facility). Vertices sharing a label form a Voronoi-style
+		// partition of the Graph. Distances are measured along edges leaving the
+		// facilities; to measure distances from each vertex to its nearest
+		// facility, call this on reversed() instead.
+		// @facilities			Identities (integers) of the facility vertices.
+		// @return				The partition (all vertices unlabeled if any facility
+		//							identity is invalid).
+		FacilityPartition nearestFacilities(const vector<int> &facilities) const {
+			FacilityPartition partition;
+			partition.facility_.assign(number_of_vertices_, 0);
+			partition.distance_.assign(number_of_vertices_, INT_MAX);
+			partition.previous_.assign(number_of_vertices_, -1);
+			
+			SearchState state(number_of_vertices_);
+			
+			// Vertices settle after their prior vertex, which is already labeled.
+			search(facilities, state, [](const int, const int, const float) { return true; },
+					 [&](const int v, const float distance) {
+				const int previous = state.previous(v);
+				
+				partition.facility_[v] = (previous == -1) ? v + 1 :
+					partition.facility_[previous];
+				partition.distance_[v] = distance;
+				partition.previous_[v] = previous;
+				return true;
+			});
+			
+			return partition;
+		}
+	
+		// @return		A Graph with the same vertices and every edge reversed,
+		//					e.g. for searching distances toward a vertex.
+		Graph reversed() const {
+			Graph newGraph(number_of_vertices_);
+			vector<long> offsets(number_of_vertices_ + 1, 0);
+			
+			for(int v = 0; v < number_of_vertices_; v++) {
+				const Vertex &opV = graph_vertices_[v];
+				for(size_t i = 0; i < opV.adjacent_vertices_.size(); i++) {
+					if(opV.edge_weights_[i] >= 0.0) {
+						offsets[opV.adjacent_vertices_[i] + 1]++;
+					}
+				}
+			}
+			
+			newGraph.reserveEdges(offsets);
+			
+			for(int v = 0; v < number_of_vertices_; v++) {
+				const Vertex &opV = graph_vertices_[v];
+				for(size_t i = 0; i < opV.adjacent_vertices_.size(); i++) {
+					if(opV.edge_weights_[i] >= 0.0) {
+						placeEdge(newGraph.graph_vertices_[opV.adjacent_vertices_[i]],
+									 v, opV.edge_weights_[i]);
+					}
+				}
+			}
+			
+			newGraph.packEdges();
+			return newGraph;
+		}
+	
+		// PUBLIC STRUCT - DEGREEINFORMATION (see getDegreeInformation)
+		struct DegreeInformation {
+			int numberOfEdges; // Undirected: half the directed edges.
+			int smallestDegree;
+			int largestDegree;
+			float averageDegree;
+		};
+	
+		// Utility for computing degree information of Graph instance: number of
 		// edges, smallest degree, largest degree, and average degree.
-		// Post-Condition: 	All degree information of the Graph instance has been
-		//							output.
-		void outputDegreeInformation() {
+		// @return				DegreeInformation of the Graph (all zero if empty).
+		DegreeInformation getDegreeInformation() const {
+			DegreeInformation info = {0, 0, 0, 0.0};
 			
 			// Check if Graph is empty
 			if(number_of_vertices_ == 0) {
-				cout << "Graph is empty." << endl;
-				return;
+				return info;
 			}
 			
 			int totalDegrees(0), largestDegree(0),
@@ -160,7 +725,8 @@ public:
 			// For each Vertex in the Graph...
 			for(int i = 0; i < number_of_vertices_; i++) {
 				int currentDegree =
-					static_cast<int>(graph_vertices_[i].adjacent_vertices_.size());
+					static_cast<int>(graph_vertices_[i].adjacent_vertices_.size()) -
+					graph_vertices_[i].dead_edges_;
 				
 				// Update total degree of Graph
 				totalDegrees += currentDegree;
@@ -177,53 +743,157 @@ public:
 			}
 			
 			// Calculate number of edges and average degree
-			int numberOfEdges = (totalDegrees / 2);
-			float avgDegree = (totalDegrees / number_of_vertices_);
+			info.numberOfEdges = (totalDegrees / 2);
+			info.smallestDegree = smallestDegree;
+			info.largestDegree = largestDegree;
+			info.averageDegree = static_cast<float>(totalDegrees) /
+				number_of_vertices_;
+			
+			return info;
+		}
+	
+		// Utility for printing degree information of Graph instance: number of
+		// edges, smallest degree, largest degree, and average degree.
+		// Post-Condition: 	All degree information of the Graph instance has been
+		//							output.
+		void outputDegreeInformation() const {
+			
+			// Check if Graph is empty
+			if(number_of_vertices_ == 0) {
+				cout << "Graph is empty." << endl;
+				return;
+			}
 			
-			cout << "Number of Edges: " << numberOfEdges << endl;
-			cout << "Smallest Degree: " << smallestDegree << endl;
-			cout << "Largest Degree: " << largestDegree << endl;
-			cout << "Average Degree: " << setprecision(1) << avgDegree
-				  << endl << endl;
+			const DegreeInformation info = getDegreeInformation();
 			
+			cout << "Number of Undirected Edges: " << info.numberOfEdges << endl;
+			cout << "Smallest Degree: " << info.smallestDegree << endl;
+			cout << "Largest Degree: " << info.largestDegree << endl;
+			cout << "Average Degree: " << fixed << setprecision(1)
+				  << info.averageDegree << endl << endl;
+			
+		}
+	
+		// @return		Number of vertices in the Graph.
+		int numberOfVertices() const {
+			return number_of_vertices_;
+		}
+	
+		// PUBLIC TYPE - HANDLE (shared ownership of a read-only Graph)
+		typedef shared_ptr<const Graph> Handle;
+	
+		// Move a Graph into a Handle, without copying its vertices.
+		// @graph		Graph to share; left empty.
+		// @return		A Handle to the Graph; copies of it share the one Graph.
+		static Handle share(Graph &&graph) {
+			return make_shared<const Graph>(std::move(graph));
 		}
 
 private:
 
+	// PRIVATE STRUCT TEMPLATE - EDGEARRAY
+	// A vertex's run of targets or weights within the Graph's edge blocks;
+	// the Graph owns the memory, so a vertex holds none of its own.
+	template <typename T>
+	struct EdgeArray {
+		T *data_;
+		int size_;
+		
+		EdgeArray() : data_{nullptr}, size_{0} { }
+		
+		size_t size() const { return size_; }
+		T *data() { return data_; }
+		const T *data() const { return data_; }
+		T *begin() { return data_; }
+		const T *begin() const { return data_; }
+		T *end() { return data_ + size_; }
+		const T *end() const { return data_ + size_; }
+		T &operator[](const size_t i) { return data_[i]; }
+		const T &operator[](const size_t i) const { return data_[i]; }
+	};
+	
 	// PRIVATE STRUCT - VERTEX
 	struct Vertex {
 	
-		// Data members
-		list<Vertex*> adjacent_vertices_;
-		list<float> edge_weights_;
+		// Data members - adjacent vertices are stored as indices (identity - 1)
+		// into graph_vertices_, parallel to their edge weights.
+		EdgeArray<int> adjacent_vertices_;
+		// A removed edge stays in place with a negative weight (a tombstone)
+		// until the vertex is compacted.
+		EdgeArray<float> edge_weights_;
+		int capacity_; // Room for edges in the vertex's runs.
+		int dead_edges_;
 		int identity_;
 		bool known_;
 		float distance_;
-		Vertex* previous_vertex_;
+		int previous_vertex_; // Index of the prior vertex on the path; -1 if none.
 		
 		// Default Constructor
-		Vertex() : identity_{0}, known_{false}, distance_{0.0},
-				  previous_vertex_{nullptr} { }
+		Vertex() : capacity_{0}, dead_edges_{0}, identity_{0}, known_{false},
+				  distance_{0.0}, previous_vertex_{-1} { }
 		
 		// Parameterized Constructor
-		Vertex(int identity) : identity_{identity}, known_{false}, distance_{0.0},
-				  previous_vertex_{nullptr} { }
+		Vertex(int identity) : capacity_{0}, dead_edges_{0},
+				  identity_{identity}, known_{false}, distance_{0.0},
+				  previous_vertex_{-1} { }
 		
 		// Definition of operator < for Vertex. Vertices to be sorted based on
 		// distance (from an origin vertex).
 		bool operator<(const Vertex & rhs) const {
 			return distance_ < rhs.distance_;
 		}
+	
+	};
+	
+	// PRIVATE STRUCT - NOEXTRAEDGES (search() with only the Graph's own edges)
+	struct NoExtraEdges {
+		template <typename Relax>
+		void operator()(const int, Relax &) const { }
+	};
+	
+	// PRIVATE STRUCT - QUEUEENTRY
+	// Lightweight priority queue entry: a vertex index keyed by tentative
+	// distance, so that the queue never copies Vertex adjacency.
+	struct QueueEntry {
+		float distance_;
+		int vertex_;
+		
+		QueueEntry(float distance = 0.0, int vertex = 0) :
+			distance_{distance}, vertex_{vertex} { }
 		
-		// Destructor
-		~Vertex() {
-			previous_vertex_ = nullptr;
+		bool operator<(const QueueEntry & rhs) const {
+			return distance_ < rhs.distance_;
 		}
-	
 	};
 	
 	vector<Vertex> graph_vertices_;
 	int number_of_vertices_;
+	long dead_edges_; // Tombstones across all vertices.
+	// Self-loops and duplicate edges dropped while edges were added.
+	long self_loops_;
+	long duplicate_edges_;
+	
+	// Edge blocks holding every vertex's runs (see EdgeArray). Runs outgrown
+	// by addEdge are left behind in their blocks until compact(). Blocks are
+	// only shared by Graphs made with shareEdges(), never written through.
+	vector<shared_ptr<int>> target_blocks_;
+	vector<shared_ptr<float>> weight_blocks_;
+	long block_used_;			// Slots taken in the last block.
+	long block_capacity_;		// Slots in the last block.
+	// While every vertex's edges are packed back to back in the first block,
+	// in vertex order, vertex i's are slots [packed_offsets_[i],
+	// packed_offsets_[i + 1]) (see GraphStatistics); empty otherwise.
+	vector<long> packed_offsets_;
+	
+	// GraphBuilder and GraphLoader fill vertex adjacency directly;
+	// ReducedGraph, Centrality, ReachabilityIndex and GraphStatistics read it.
+	friend class GraphBuilder;
+	friend class GraphLoader;
+	friend class ReducedGraph;
+	friend class Centrality;
+	friend class ReachabilityIndex;
+	friend class GraphStatistics;
+	friend class ConcurrentGraph;
 	
 	
 	/*
@@ -232,85 +902,32 @@ private:
 	*****************************************************************************
 	*/
 	
-	// Execute Dijkstra's algorithm for a given beginning vertex. Employs a
-	//	priority queue (implemented via a binary heap) to manage selection of
-	//	vertices, and uses the method of re-inserting a vertex into the queue
-	//	every time the distance of an unknown vertex is updated, rather than
-	//	directly modifying the existing queue entry directly (a more costly and
-	//	complex operation). To support this approach, the function ignores already
-	// known vertices that are dequeued.
+	// Execute Dijkstra's algorithm for a given beginning vertex, recording the
+	// results in the Graph's vertices (for printPath). The algorithm itself is
+	// run by shortestPaths, which employs a priority queue (implemented via a
+	// binary heap) to manage selection of vertices, and uses the method of
+	// re-inserting a vertex into the queue every time the distance of an
+	// unknown vertex is updated, rather than directly modifying the existing
+	// queue entry (a more costly and complex operation). To support this
+	// approach, already known vertices that are dequeued are ignored.
 	//	@from 				The identity (integer) of an origin vertex from which to
 	//							calculate paths and distances.
 	// Pre-Condition:		The graph has been properly intialized.
 	// Post-Condition:	Dijkstra's algorithm has been properly executed,
 	//							recording distance values in all graph vertices which
 	//							accurately reflect distance from the origin vertex,
-	//							and a pointer in each vertex to the prior vertex on the
-	//							path from the origin to the given vertex.
+	//							and the index of the prior vertex on the path from the
+	//							origin in each vertex.
 	void dijkstraAlgorithm(const int from) {
-	
-		// Create Queue and initialize all vertices to unknown and "infinity"
-		// distance.
-		BinaryHeap<Vertex> queue;
+		vector<float> distance;
+		vector<int> previous;
 		
-		for(int i = 0; i < number_of_vertices_; i++) {
-			graph_vertices_[i].distance_ = INT_MAX;
-			graph_vertices_[i].known_ = false;
-		}
+		shortestPaths(from, distance, previous);
 		
-		// Zero distance of origin Vertex and insert into queue
-		graph_vertices_[from-1].distance_ = 0.0;
-		queue.insert(graph_vertices_[from-1]);
-		
-		// While there are vertices to process...
-		while(true) {
-			bool success = false;
-			int identity = 0; // Selected vertex identity.
-			
-			// While the queue is not empty and still dequeueing known vertex
-			//	duplicate representatives, continue to dequeue.
-			while(!queue.isEmpty() && !success) {
-				identity = (queue.findMin()).identity_;
-				queue.deleteMin();
-				
-				if(!graph_vertices_[identity - 1].known_) {
-					success = true;
-				}
-			}
-			
-			// If no unknown vertices remain; terminate algorithm.
-			if(!success) {
-				break;
-			}
-			
-			// Else operate on selected vertex.
-			Vertex &opV = graph_vertices_[identity-1];
-			
-			opV.known_ = true;
-			
-			auto it = opV.adjacent_vertices_.begin();
-			auto it2 = opV.edge_weights_.begin();
-			
-			// Iterate through vertices adjacent to selected vertex. If an
-			// adjacent vertex is unknown and the distance from the origin to the
-			// selected vertex + the cost of the edge from the selected vertex
-			// to the adjacent vertex is less than the previously known distance,
-			// update the distance and path (pointer to prior vertex - now selected
-			// vertex) and reinsert vertex into the queue.
-			while(it != opV.adjacent_vertices_.end()) {
-				if(!(*it)->known_) {
-					float costVW = *it2;
-					
-					if((opV.distance_ + costVW) < (*it)->distance_) {
-						(*it)->distance_ = opV.distance_ + costVW;
-						(*it)->previous_vertex_ = &opV;
-						queue.insert(*(*it));
-					}
-				}
-				
-				it++;
-				it2++;
-			}
+		for(int i = 0; i < number_of_vertices_; i++) {
+			graph_vertices_[i].distance_ = distance[i];
+			graph_vertices_[i].known_ = (distance[i] != INT_MAX);
+			graph_vertices_[i].previous_vertex_ = previous[i];
 		}
 	}
 	
@@ -323,18 +940,320 @@ private:
 	//							vertex to v.
 	// Post-Condition:	The path for the initial vertex has been printed in
 	//							full.
-	void printPath(Vertex &v) {
-		if(v.previous_vertex_ != nullptr) {
-			printPath(*(v.previous_vertex_));
+	void printPath(const Vertex &v) const {
+		if(v.previous_vertex_ != -1) {
+			printPath(graph_vertices_[v.previous_vertex_]);
 			cout << ", ";
 		}
 		cout << v.identity_;
 	}
 	
+	// Find the entry of an edge (live or tombstoned) in its origin's adjacency.
+	// @from		Index (identity - 1) of the origin vertex.
+	// @to		Index (identity - 1) of the target vertex.
+	// @return	Position of the edge in the origin's adjacency; -1 if none.
+	int findEdge(const int from, const int to) const {
+		const EdgeArray<int> &adjacent = graph_vertices_[from].adjacent_vertices_;
+		
+		for(size_t i = 0; i < adjacent.size(); i++) {
+			if(adjacent[i] == to) {
+				return static_cast<int>(i);
+			}
+		}
+		
+		return -1;
+	}
+	
+	// Erase the tombstoned edges of a vertex, keeping live edges in order.
+	// @v			Vertex to compact.
+	void compactVertex(Vertex &v) {
+		size_t kept = 0;
+		
+		for(size_t i = 0; i < v.adjacent_vertices_.size(); i++) {
+			if(v.edge_weights_[i] >= 0.0) {
+				v.adjacent_vertices_[kept] = v.adjacent_vertices_[i];
+				v.edge_weights_[kept] = v.edge_weights_[i];
+				kept++;
+			}
+		}
+		
+		v.adjacent_vertices_.size_ = v.edge_weights_.size_ =
+			static_cast<int>(kept);
+		dead_edges_ -= v.dead_edges_;
+		v.dead_edges_ = 0;
+		packed_offsets_.clear();
+	}
+	
+	// Append an edge to a vertex's runs, which must have room for it.
+	static void placeEdge(Vertex &v, const int to, const float weight) {
+		v.adjacent_vertices_.data_[v.adjacent_vertices_.size_++] = to;
+		v.edge_weights_.data_[v.edge_weights_.size_++] = weight;
+	}
+	
+	// Append an edge to a vertex, first moving its edges to runs of twice the
+	// size when they are full.
+	void appendEdge(Vertex &v, const int to, const float weight) {
+		if(v.adjacent_vertices_.size_ == v.capacity_) {
+			const int capacity = max(4, 2 * v.capacity_);
+			int *targets;
+			float *weights;
+			allocateEdges(capacity, targets, weights);
+			
+			copy(v.adjacent_vertices_.begin(), v.adjacent_vertices_.end(), targets);
+			copy(v.edge_weights_.begin(), v.edge_weights_.end(), weights);
+			v.adjacent_vertices_.data_ = targets;
+			v.edge_weights_.data_ = weights;
+			v.capacity_ = capacity;
+			packed_offsets_.clear();
+		}
+		
+		placeEdge(v, to, weight);
+	}
+	
+	// @return		A new edge block of a number of slots.
+	template <typename T>
+	static shared_ptr<T> newBlock(const long size) {
+		return shared_ptr<T>(new T[size], default_delete<T[]>());
+	}
+	
+	// Take runs for a number of edges from the last edge block, starting a
+	// new (larger) block when it is full.
+	void allocateEdges(const long count, int *&targets, float *&weights) {
+		if(target_blocks_.empty() || block_capacity_ - block_used_ < count) {
+			block_capacity_ = max(count,
+										 min(1L << 20, max(1024L, 2 * block_capacity_)));
+			block_used_ = 0;
+			target_blocks_.push_back(newBlock<int>(block_capacity_));
+			weight_blocks_.push_back(newBlock<float>(block_capacity_));
+		}
+		
+		targets = target_blocks_.back().get() + block_used_;
+		weights = weight_blocks_.back().get() + block_used_;
+		block_used_ += count;
+	}
+	
+	// Bulk construction, step 1: give every vertex an empty run of the given
+	// size, back to back in one new block (for GraphBuilder, GraphLoader and
+	// reversed()). Edges are then added with placeEdge, and packEdges closes
+	// any gaps left once they are all in.
+	// @offsets			Number of edges of vertex i at offsets[i + 1] (and 0 at
+	//						offsets[0]); turned into their running sum.
+	// Pre-Condition:	The Graph has no edges.
+	void reserveEdges(vector<long> &offsets) {
+		for(int v = 0; v < number_of_vertices_; v++) {
+			offsets[v + 1] += offsets[v];
+		}
+		
+		const long total = offsets[number_of_vertices_];
+		target_blocks_.clear();
+		weight_blocks_.clear();
+		block_used_ = block_capacity_ = 0;
+		
+		int *targets = nullptr;
+		float *weights = nullptr;
+		if(total > 0) {
+			allocateEdges(total, targets, weights);
+		}
+		
+		for(int v = 0; v < number_of_vertices_; v++) {
+			Vertex &opV = graph_vertices_[v];
+			opV.adjacent_vertices_.data_ = targets + offsets[v];
+			opV.edge_weights_.data_ = weights + offsets[v];
+			opV.adjacent_vertices_.size_ = opV.edge_weights_.size_ = 0;
+			opV.capacity_ = static_cast<int>(offsets[v + 1] - offsets[v]);
+		}
+		
+		packed_offsets_.clear();
+	}
+	
+	// Bulk construction, step 2: move runs left to close the gaps left by
+	// edges that were reserved but never placed (e.g. dropped duplicates), so
+	// that every vertex's edges are packed back to back.
+	void packEdges() {
+		int *const targets = target_blocks_.empty() ? nullptr :
+			target_blocks_[0].get();
+		float *const weights = weight_blocks_.empty() ? nullptr :
+			weight_blocks_[0].get();
+		
+		packed_offsets_.assign(number_of_vertices_ + 1, 0);
+		long next = 0;
+		
+		for(int v = 0; v < number_of_vertices_; v++) {
+			Vertex &opV = graph_vertices_[v];
+			
+			if(opV.adjacent_vertices_.data_ != targets + next) {
+				copy(opV.adjacent_vertices_.begin(), opV.adjacent_vertices_.end(),
+					  targets + next);
+				copy(opV.edge_weights_.begin(), opV.edge_weights_.end(),
+					  weights + next);
+				opV.adjacent_vertices_.data_ = targets + next;
+				opV.edge_weights_.data_ = weights + next;
+			}
+			
+			opV.capacity_ = opV.adjacent_vertices_.size_;
+			next += opV.adjacent_vertices_.size_;
+			packed_offsets_[v + 1] = next;
+		}
+		
+		block_used_ = next;
+	}
+	
+	// @return		Number of live directed edges (excluding tombstones); O(1)
+	//					while the edges are packed, O(V) otherwise.
+	long liveEdges() const {
+		if(!packed_offsets_.empty()) {
+			return packed_offsets_[number_of_vertices_] - dead_edges_;
+		}
+		
+		long total = 0;
+		for(int v = 0; v < number_of_vertices_; v++) {
+			total += graph_vertices_[v].adjacent_vertices_.size_;
+		}
+		return total - dead_edges_;
+	}
+	
+	// Pack every vertex's live edges back to back, in vertex order, into one
+	// new block, dropping tombstones and space left behind by runs that were
+	// outgrown; the old blocks are then released.
+	void pack() {
+		const long total = liveEdges();
+		
+		shared_ptr<int> targets = newBlock<int>(max(1L, total));
+		shared_ptr<float> weights = newBlock<float>(max(1L, total));
+		packed_offsets_.assign(number_of_vertices_ + 1, 0);
+		
+		for(int v = 0; v < number_of_vertices_; v++) {
+			Vertex &opV = graph_vertices_[v];
+			long kept = packed_offsets_[v];
+			
+			for(size_t i = 0; i < opV.adjacent_vertices_.size(); i++) {
+				if(opV.edge_weights_[i] >= 0.0) {
+					targets.get()[kept] = opV.adjacent_vertices_[i];
+					weights.get()[kept] = opV.edge_weights_[i];
+					kept++;
+				}
+			}
+			
+			opV.adjacent_vertices_.data_ = targets.get() + packed_offsets_[v];
+			opV.edge_weights_.data_ = weights.get() + packed_offsets_[v];
+			opV.adjacent_vertices_.size_ = opV.edge_weights_.size_ = opV.capacity_ =
+				static_cast<int>(kept - packed_offsets_[v]);
+			opV.dead_edges_ = 0;
+			packed_offsets_[v + 1] = kept;
+		}
+		
+		target_blocks_.clear();
+		weight_blocks_.clear();
+		target_blocks_.push_back(std::move(targets));
+		weight_blocks_.push_back(std::move(weights));
+		block_used_ = total;
+		block_capacity_ = max(1L, total);
+		dead_edges_ = 0;
+	}
+	
+	// A copy of the Graph whose runs stay in, and share ownership of, this
+	// Graph's edge blocks, made in O(V) without copying any edge (for
+	// ConcurrentGraph merges). Its runs must never be written in place, so
+	// its edges may only be changed through rewriteEdges (and compact()).
+	Graph shareEdges() const {
+		Graph copy(0);
+		copy.graph_vertices_ = graph_vertices_;
+		copy.number_of_vertices_ = number_of_vertices_;
+		copy.dead_edges_ = dead_edges_;
+		copy.self_loops_ = self_loops_;
+		copy.duplicate_edges_ = duplicate_edges_;
+		copy.target_blocks_ = target_blocks_;
+		copy.weight_blocks_ = weight_blocks_;
+		copy.packed_offsets_ = packed_offsets_;
+		// Runs are taken from new blocks of the copy's own.
+		copy.block_used_ = copy.block_capacity_ = 0;
+		return copy;
+	}
+	
+	// Move a vertex's edges into new runs of their own with a list of changes
+	// applied; the old runs are left behind, unwritten. Live edges keep their
+	// order and tombstones are dropped; added edges follow, in list order.
+	// @v				Index of the vertex.
+	// @changes		(target index, weight) of each changed edge: the edge is
+	//					updated, added if absent, or removed if the weight is
+	//					negative. At most one change per target.
+	// @return		Number of slots in the runs left behind.
+	// Pre-Condition:	The vertex has at most one live edge to each target.
+	long rewriteEdges(const int v, const vector<pair<int, float>> &changes) {
+		Vertex &opV = graph_vertices_[v];
+		const int *const oldTargets = opV.adjacent_vertices_.data_;
+		const float *const oldWeights = opV.edge_weights_.data_;
+		const int oldSize = opV.adjacent_vertices_.size_;
+		const long abandoned = opV.capacity_;
+		
+		// Changes by target, with their position in the list.
+		vector<pair<int, int>> byTarget(changes.size());
+		for(size_t i = 0; i < changes.size(); i++) {
+			byTarget[i] = make_pair(changes[i].first, static_cast<int>(i));
+		}
+		sort(byTarget.begin(), byTarget.end());
+		vector<bool> applied(changes.size(), false);
+		
+		// New weight of each old edge (negative if it is dropped).
+		vector<float> kept(oldWeights, oldWeights + oldSize);
+		int capacity = 0;
+		for(int i = 0; i < oldSize; i++) {
+			if(kept[i] >= 0.0) {
+				const auto it = lower_bound(byTarget.begin(), byTarget.end(),
+													 make_pair(oldTargets[i], INT_MIN));
+				if(it != byTarget.end() && it->first == oldTargets[i]) {
+					applied[it->second] = true;
+					kept[i] = changes[it->second].second;
+				}
+			}
+			capacity += kept[i] >= 0.0 ? 1 : 0;
+		}
+		for(size_t i = 0; i < changes.size(); i++) {
+			capacity += !applied[i] && changes[i].second >= 0.0 ? 1 : 0;
+		}
+		
+		int *targets = nullptr;
+		float *weights = nullptr;
+		if(capacity > 0) {
+			allocateEdges(capacity, targets, weights);
+		}
+		opV.adjacent_vertices_.data_ = targets;
+		opV.edge_weights_.data_ = weights;
+		opV.adjacent_vertices_.size_ = opV.edge_weights_.size_ = 0;
+		opV.capacity_ = capacity;
+		
+		for(int i = 0; i < oldSize; i++) {
+			if(kept[i] >= 0.0) {
+				placeEdge(opV, oldTargets[i], kept[i]);
+			}
+		}
+		for(size_t i = 0; i < changes.size(); i++) {
+			if(!applied[i] && changes[i].second >= 0.0) {
+				placeEdge(opV, changes[i].first, changes[i].second);
+			}
+		}
+		
+		dead_edges_ -= opV.dead_edges_;
+		opV.dead_edges_ = 0;
+		packed_offsets_.clear();
+		return abandoned;
+	}
+	
+	// Leave the Graph empty (after being moved from).
+	void clearAll() noexcept {
+		graph_vertices_.clear();
+		number_of_vertices_ = 0;
+		dead_edges_ = self_loops_ = duplicate_edges_ = 0;
+		target_blocks_.clear();
+		weight_blocks_.clear();
+		block_used_ = block_capacity_ = 0;
+		packed_offsets_.clear();
+	}
+	
 	// Check for valid vertex selection.
 	// @identity	An identity (integer) of a vertex.
 	// @return		True if identity is within range of ids; false otherwise.
-	bool isValidVertex(const int identity) {
+	bool isValidVertex(const int identity) const {
 		if(identity < 1 || identity > number_of_vertices_) {
 			return false;
 		}
@@ -0,0 +1,273 @@
+/*
+File Name: GraphBuilder.h
+Date Begun: 10/18/2026
+
+This header file contains the interface and implementation (for ease of
+compilation) of the GraphBuilder class, used to construct large Graphs in
+bulk. Edges may be added in any order; they are staged in large contiguous
+chunks (an arena of Edge records, one allocation per chunk rather than per
+edge) and finalized into a Graph with a single counting-sort pass over the
+origin vertices, straight into one packed edge block of the Graph (see
+Graph.h), so the Graph built holds no per-vertex allocations and is released
+in O(1) frees. Dropping the builder releases the arena chunk by chunk.
+
+The rules for which edges are kept (checkEdge) and the finalize steps
+(countEdges, then fillVertices) are shared with GraphLoader (see
+GraphLoader.h), which runs them on one partition of vertices per thread, so
+that a Graph loaded from a file and one built here always agree.
+
+PUBLIC OPERATIONS:
+* addEdge(from, to, edge weight)		Stage a (directed) edge for the graph.
+* numberOfStagedEdges()				Number of edges currently staged.
+* build()									Finalize all staged edges into a Graph.
+
+*/
+
+#ifndef GraphBuilder_h
+#define GraphBuilder_h
+
+#include <iostream>
+#include <memory>
+#include <vector>
+#include "Graph.h"
+using namespace std;
+
+class GraphBuilder {
+public:
+
+		// Constructor
+		// @size			Number of vertices of the Graph to be built.
+		// @chunkSize	Number of edges staged per arena chunk.
+		explicit GraphBuilder(const int size = 10, const int chunkSize = 65536) :
+			number_of_vertices_{size}, chunk_size_{chunkSize > 0 ? chunkSize : 1},
+			number_of_edges_{0}, self_loops_{0} { }
+
+		// Stage a directed edge between two vertices.
+		// @from					Identity (integer) of the origin vertex.
+		// @to					Identity (integer) of the target vertex.
+		// edgeWeight			A non-negative weight (float) for the new edge.
+		// Pre-Conditions:	from and to represent valid vertex identities
+		//							(integers) and the edge weight is non-negative. These
+		//							pre-conditions are checked, as in Graph::addEdge.
+		// Post-Conditions:	The edge has been appended to the arena. Self-loops
+		//							are dropped here; duplicates are dropped by build().
+		void addEdge(const int from, const int to, float edgeWeight) {
+			// Check valid input
+			const EdgeCheck check = checkEdge(from, to, edgeWeight,
+														 number_of_vertices_);
+
+			if(check == kInvalidEdge) {
+				cout << "Invalid input! Please provide vertex selections between "
+					  << "1 and " << number_of_vertices_ << " and positive edge "
+					  << "edge weight." << endl << endl;
+				return;
+			}
+
+			if(check == kSelfLoop) {
+				self_loops_++;
+				return;
+			}
+
+			// Start a new chunk when the current one is full.
+			if(number_of_edges_ % chunk_size_ == 0) {
+				chunks_.push_back(unique_ptr<Edge[]>(new Edge[chunk_size_]));
+			}
+
+			Edge &e = chunks_.back()[number_of_edges_ % chunk_size_];
+			e.from_ = from - 1;
+			e.to_ = to - 1;
+			e.weight_ = edgeWeight;
+			number_of_edges_++;
+		}
+
+		// @return		Number of edges staged (and not yet built).
+		long numberOfStagedEdges() const {
+			return number_of_edges_;
+		}
+
+		// Finalize all staged edges into a Graph. Edges are bucketed by origin
+		// vertex with a (stable) counting sort, so each vertex's adjacency keeps
+		// the order in which its edges were staged; the first staged edge between
+		// a pair of vertices wins, exactly as with repeated Graph::addEdge calls.
+		// @return				A Graph containing every valid staged edge.
+		// Post-Condition:	The arena has been released and the builder is empty.
+		Graph build() {
+			Graph newGraph(number_of_vertices_);
+
+			// Count edges per origin vertex and reserve each vertex's run.
+			vector<long> offsets(number_of_vertices_ + 1, 0);
+			countEdges(StagedEdges(*this, false), offsets);
+			newGraph.reserveEdges(offsets);
+
+			// Fill the runs, releasing each arena chunk as soon as it has been
+			// consumed to keep peak memory down.
+			newGraph.duplicate_edges_ = fillVertices(newGraph, 0,
+				number_of_vertices_, StagedEdges(*this, true));
+
+			newGraph.self_loops_ = self_loops_;
+			clear();
+
+			newGraph.packEdges();
+			return newGraph;
+		}
+
+		// Discard all staged edges.
+		void clear() {
+			chunks_.clear();
+			number_of_edges_ = 0;
+			self_loops_ = 0;
+		}
+
+private:
+
+	// PRIVATE STRUCT - EDGE (staged in the arena; vertices are 0-based indices)
+	struct Edge {
+		int from_;
+		int to_;
+		float weight_;
+	};
+
+	// PRIVATE ENUM - EDGECHECK (see checkEdge)
+	enum EdgeCheck { kValidEdge, kInvalidEdge, kSelfLoop };
+
+	// PRIVATE STRUCT - STAGEDEDGES (the staged edges, as for countEdges)
+	struct StagedEdges {
+		GraphBuilder &builder_;
+		bool release_; // Release each arena chunk once consumed.
+
+		StagedEdges(GraphBuilder &builder, const bool release) :
+			builder_(builder), release_{release} { }
+
+		// Call f(edge) for every staged edge, in staging order.
+		template <typename Function>
+		void operator()(Function f) const {
+			for(size_t c = 0; c < builder_.chunks_.size(); c++) {
+				const long chunkEdges = min<long>(builder_.chunk_size_,
+					builder_.number_of_edges_ -
+					static_cast<long>(c) * builder_.chunk_size_);
+
+				for(long i = 0; i < chunkEdges; i++) {
+					f(builder_.chunks_[c][i]);
+				}
+
+				if(release_) {
+					builder_.chunks_[c].reset();
+				}
+			}
+		}
+	};
+
+	vector<unique_ptr<Edge[]>> chunks_;
+	int number_of_vertices_;
+	int chunk_size_;
+	long number_of_edges_;
+	long self_loops_; // Dropped while staging.
+
+	// GraphLoader stages edges and finalizes partitions with the same rules.
+	friend class GraphLoader;
+
+
+	/*
+	*****************************************************************************
+	****************************PRIVATE FUNCTIONS********************************
+	*****************************************************************************
+	*/
+
+	// Check an edge given by vertex identities (integers): invalid edges are
+	// reported by the caller, self-loops are dropped (and counted), and
+	// duplicates are dropped later, by fillVertices.
+	// @size		Number of vertices of the Graph.
+	// @return	Whether the edge is valid, invalid or a self-loop.
+	static EdgeCheck checkEdge(const long from, const long to,
+										const float edgeWeight, const int size) {
+		if(from < 1 || from > size || to < 1 || to > size || edgeWeight < 0.0) {
+			return kInvalidEdge;
+		}
+		if(from == to) {
+			return kSelfLoop;
+		}
+		return kValidEdge;
+	}
+
+	// Finalize, step 1: count the edges of each origin vertex.
+	// @forEachEdge	Called as forEachEdge(f); calls f(edge) for every edge
+	//						(see StagedEdges).
+	// @offsets			Edges of vertex i are added to offsets[i + 1].
+	template <typename ForEachEdge>
+	static void countEdges(ForEachEdge forEachEdge, vector<long> &offsets) {
+		forEachEdge([&](const Edge &e) { offsets[e.from_ + 1]++; });
+	}
+
+	// Finalize, step 2 (once every run has been reserved, see
+	// Graph::reserveEdges): place every edge of a range of origin vertices in
+	// its origin's run, in the order given (a stable counting sort), then drop
+	// duplicate targets of each vertex, keeping the first. Only the vertices
+	// of the range are written, so threads may fill disjoint ranges at once;
+	// Graph::packEdges then closes the gaps left by dropped duplicates.
+	// @graph				Graph being built.
+	// @firstVertex		First vertex index of the range.
+	// @endVertex			Vertex index past the end of the range.
+	// @forEachEdge		As for countEdges; every edge has its origin in the
+	//							range.
+	// @return				Number of duplicate edges dropped.
+	template <typename ForEachEdge>
+	static long fillVertices(Graph &graph, const int firstVertex,
+									 const int endVertex, ForEachEdge forEachEdge) {
+		forEachEdge([&](const Edge &e) {
+			Graph::placeEdge(graph.graph_vertices_[e.from_], e.to_, e.weight_);
+		});
+
+		long duplicates = 0;
+		vector<pair<int, int>> sorted;
+
+		for(int v = firstVertex; v < endVertex; v++) {
+			Graph::Vertex &opV = graph.graph_vertices_[v];
+			int *const targets = opV.adjacent_vertices_.data();
+			float *const weights = opV.edge_weights_.data();
+			const int end = opV.adjacent_vertices_.size_;
+			int kept = 0;
+
+			// Skip duplicate targets: short lists are checked directly, longer
+			// ones by sorting (target, position) pairs. Either way the memory
+			// used stays proportional to the vertex, not to the Graph.
+			if(end <= 32) {
+				for(int i = 0; i < end; i++) {
+					if(find(targets, targets + kept, targets[i]) == targets + kept) {
+						targets[kept] = targets[i];
+						weights[kept] = weights[i];
+						kept++;
+					}
+				}
+			}
+			else {
+				sorted.clear();
+				for(int i = 0; i < end; i++) {
+					sorted.push_back(make_pair(targets[i], i));
+				}
+				sort(sorted.begin(), sorted.end());
+
+				for(size_t j = 1; j < sorted.size(); j++) {
+					if(sorted[j].first == sorted[j - 1].first) {
+						targets[sorted[j].second] = -1;
+					}
+				}
+
+				for(int i = 0; i < end; i++) {
+					if(targets[i] != -1) {
+						targets[kept] = targets[i];
+						weights[kept] = weights[i];
+						kept++;
+					}
+				}
+			}
+
+			duplicates += end - kept;
+			opV.adjacent_vertices_.size_ = opV.edge_weights_.size_ = kept;
+		}
+
+		return duplicates;
+	}
+
+};
+
+#endif /* GraphBuilder_h */
@@ -0,0 +1,58 @@
+/*
+File Name: GraphFiles.h
+Date Begun: 10/19/2026
+
+This header file contains the file utilities shared by the driver programs:
+opening an input or query file, and loading a Graph from a .txt file in
+parallel through a GraphLoader (see GraphLoader.h).
+
+PUBLIC OPERATIONS:
+* openFile(filename)					Open an input/query file or exit.
+* createGraph(graph_filename)		Load a Graph from a .txt file.
+
+*/
+
+#ifndef GraphFiles_h
+#define GraphFiles_h
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "Graph.h"
+#include "GraphLoader.h"
+using namespace std;
+
+// Utility function for opening input/query files.
+// @filename	Valid filename of a .txt file.
+// @return		Returns an input file stream if properly initialized; else
+//					exits with error code 1.
+inline ifstream openFile(const string filename) {
+	ifstream input;
+	
+	// Open input file
+	input.open(filename);
+	
+	// Check for failure to open input file
+	if(input.fail()) {
+		cout << "Cannot read from " << filename;
+		exit(1);
+	}
+	
+	return input;
+}
+
+// Function for generating a graph based on .txt input file specifications.
+// The file is read, parsed and built in parallel by a GraphLoader.
+// @graph_filename	Valid filename of a .txt file containing graph
+//							specifications: size, followed by a list of directed edges.
+// @return				Returns a Graph initialized as specified in the .txt file.
+// Pre-Condition: 	Input contains properly formatted graph information. This
+//							pre-condition is NOT checked.
+inline Graph createGraph(const string graph_filename) {
+	GraphLoader loader;
+	
+	return loader.load(graph_filename);
+}
+
+#endif /* GraphFiles_h */
@@ -0,0 +1,322 @@
+/*
+File Name: GraphLoader.h
+Date Begun: 10/18/2026
+
+This header file contains the interface and implementation (for ease of
+compilation) of the GraphLoader class, a parallel ingestion pipeline for
+graph .txt files (size, followed by a list of directed edges per line).
+
+Loading runs in two stages:
+1) Parse: the file is split into chunks at line boundaries, and reader threads
+	read and parse their chunks in parallel into per-thread edge buffers, each
+	bucketed by the build partition (range of origin vertices) of the edge.
+2) Build: one thread per partition counts the edges of its vertices; once
+	every vertex's run has been reserved in the Graph's packed edge block,
+	each thread merges the buckets of every reader (in file order) into the
+	runs of its vertices with a counting sort, so each vertex's adjacency is
+	written by exactly one thread.
+
+Edges are checked, and partitions counted and filled, by the same routines
+GraphBuilder uses (see GraphBuilder.h), so the resulting Graph is identical to
+one built by calling addEdge for every edge in file order (including how
+duplicates, self-loops and invalid edges are handled).
+
+PUBLIC OPERATIONS:
+* load(graph_filename)		Load a Graph from a .txt file.
+
+*/
+
+#ifndef GraphLoader_h
+#define GraphLoader_h
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Graph.h"
+#include "GraphBuilder.h"
+using namespace std;
+
+class GraphLoader {
+public:
+
+		// Constructor
+		// @numberOfThreads	Number of reader (and builder) threads; 0 selects
+		//							the number of hardware threads.
+		// @minChunkBytes		Smallest chunk handed to a reader thread, so that
+		//							small files are not split needlessly.
+		explicit GraphLoader(const int numberOfThreads = 0,
+									const long minChunkBytes = 1L << 20) :
+			number_of_threads_{numberOfThreads > 0 ? numberOfThreads :
+				max(1, static_cast<int>(thread::hardware_concurrency()))},
+			min_chunk_bytes_{minChunkBytes > 0 ? minChunkBytes : 1} { }
+
+		// Load a Graph from a .txt file.
+		// @graph_filename	Valid filename of a .txt file containing graph
+		//							specifications: size, followed by a list of directed
+		//							edges.
+		// @return				Returns a Graph initialized as specified in the file;
+		//							exits with error code 1 if it cannot be read.
+		// Pre-Condition: 	Input contains properly formatted graph information.
+		//							Only vertex ranges and edge weights are checked.
+		Graph load(const string graph_filename) const {
+			ifstream graphInput(graph_filename, ios::binary);
+
+			// Check for failure to open input file
+			if(graphInput.fail()) {
+				cout << "Cannot read from " << graph_filename;
+				exit(1);
+			}
+
+			// Read in size; edges begin on the following line.
+			string line;
+			getline(graphInput, line);
+			const int size = atoi(line.c_str());
+			const long dataStart = graphInput.tellg() < 0 ? 0 :
+				static_cast<long>(graphInput.tellg());
+
+			graphInput.seekg(0, ios::end);
+			const long dataEnd = max(dataStart,
+											 static_cast<long>(graphInput.tellg()));
+
+			const int readers = static_cast<int>(max(1L, min<long>(
+				number_of_threads_, (dataEnd - dataStart) / min_chunk_bytes_)));
+			const int partitions = max(1, min(number_of_threads_, size));
+
+			// Chunk boundaries, moved forward to the start of the next line (and
+			// never before the previous boundary, should a line span chunks).
+			vector<long> boundaries(readers + 1, dataEnd);
+			boundaries[0] = dataStart;
+			for(int r = 1; r < readers; r++) {
+				boundaries[r] = max(boundaries[r - 1], nextLineStart(graphInput,
+					dataStart + (dataEnd - dataStart) * r / readers, dataEnd));
+			}
+			graphInput.close();
+
+			// Stage 1: parse chunks in parallel into per-reader buckets.
+			vector<Reader> readerState(readers, Reader(partitions));
+			vector<thread> threads;
+
+			for(int r = 0; r < readers; r++) {
+				threads.push_back(thread(&GraphLoader::parseChunk, this,
+					graph_filename, boundaries[r], boundaries[r + 1], size, partitions,
+					ref(readerState[r])));
+			}
+			joinAll(threads);
+
+			long invalidEdges = 0, selfLoops = 0;
+			for(int r = 0; r < readers; r++) {
+				invalidEdges += readerState[r].invalid_edges_;
+				selfLoops += readerState[r].self_loops_;
+			}
+			for(long i = 0; i < invalidEdges; i++) {
+				cout << "Invalid input! Please provide vertex selections between "
+					  << "1 and " << size << " and positive edge "
+					  << "edge weight." << endl << endl;
+			}
+
+			// Stage 2: each partition's vertices are counted, then built, by a
+			// single thread.
+			Graph newGraph(size);
+			vector<long> offsets(size + 1, 0);
+			vector<long> duplicates(partitions, 0);
+
+			for(int p = 0; p < partitions; p++) {
+				threads.push_back(thread(&GraphLoader::countPartition, p,
+					cref(readerState), ref(offsets)));
+			}
+			joinAll(threads);
+
+			newGraph.reserveEdges(offsets);
+
+			for(int p = 0; p < partitions; p++) {
+				threads.push_back(thread(&GraphLoader::buildPartition,
+					ref(newGraph), partitionStart(p, size, partitions),
+					partitionStart(p + 1, size, partitions), p, cref(readerState),
+					ref(duplicates[p])));
+			}
+			joinAll(threads);
+
+			newGraph.packEdges();
+			newGraph.self_loops_ = selfLoops;
+			for(int p = 0; p < partitions; p++) {
+				newGraph.duplicate_edges_ += duplicates[p];
+			}
+
+			return newGraph;
+		}
+
+private:
+
+	typedef GraphBuilder::Edge Edge;
+
+	// PRIVATE STRUCT - READER (edge buckets, one per partition, of one reader)
+	struct Reader {
+		vector<vector<Edge>> buckets_;
+		long invalid_edges_;
+		long self_loops_;
+
+		explicit Reader(const int partitions) : buckets_(partitions),
+			invalid_edges_{0}, self_loops_{0} { }
+	};
+
+	// PRIVATE STRUCT - BUCKETEDGES (a partition's edges from every reader, as
+	// for GraphBuilder::countEdges)
+	struct BucketEdges {
+		const vector<Reader> &readers_;
+		int partition_;
+
+		BucketEdges(const vector<Reader> &readers, const int partition) :
+			readers_(readers), partition_{partition} { }
+
+		// Call f(edge) for every edge of the partition, in file order.
+		template <typename Function>
+		void operator()(Function f) const {
+			for(size_t r = 0; r < readers_.size(); r++) {
+				const vector<Edge> &bucket = readers_[r].buckets_[partition_];
+				for(size_t i = 0; i < bucket.size(); i++) {
+					f(bucket[i]);
+				}
+			}
+		}
+	};
+
+	int number_of_threads_;
+	long min_chunk_bytes_;
+
+
+	/*
+	*****************************************************************************
+	****************************PRIVATE FUNCTIONS********************************
+	*****************************************************************************
+	*/
+
+	// @return		First vertex index of a partition (vertices are divided
+	//					into equal consecutive ranges).
+	static int partitionStart(const int partition, const int size,
+									  const int partitions) {
+		return static_cast<int>(static_cast<long>(size) * partition / partitions);
+	}
+
+	// @return		Partition holding a vertex index.
+	static int partitionOf(const int vertex, const int size,
+								  const int partitions) {
+		int p = static_cast<int>(static_cast<long>(vertex) * partitions / size);
+
+		// Correct for rounding in partitionStart.
+		while(p + 1 < partitions &&
+				partitionStart(p + 1, size, partitions) <= vertex) {
+			p++;
+		}
+		while(p > 0 && partitionStart(p, size, partitions) > vertex) {
+			p--;
+		}
+		return p;
+	}
+
+	// @return		Offset of the first line starting at or after position.
+	static long nextLineStart(ifstream &input, long position, const long end) {
+		if(position <= 0) {
+			return 0;
+		}
+
+		// Step back one so that a line starting exactly at position is kept.
+		input.clear();
+		input.seekg(position - 1);
+
+		char c;
+		while(position - 1 < end && input.get(c) && c != '\n') {
+			position++;
+		}
+		return min(position, end);
+	}
+
+	// Join and discard all threads.
+	static void joinAll(vector<thread> &threads) {
+		for(size_t i = 0; i < threads.size(); i++) {
+			threads[i].join();
+		}
+		threads.clear();
+	}
+
+	// Read and parse one chunk of whole lines, "origin (target weight)*", into
+	// a reader's buckets. Self-loops are dropped here; duplicates are dropped
+	// when building.
+	void parseChunk(const string graph_filename, const long begin,
+						 const long end, const int size, const int partitions,
+						 Reader &reader) const {
+		vector<char> buffer(end - begin + 1, '\0');
+
+		ifstream graphInput(graph_filename, ios::binary);
+		graphInput.seekg(begin);
+		graphInput.read(buffer.data(), end - begin);
+
+		char *position = buffer.data();
+		char *const bufferEnd = buffer.data() + (end - begin);
+
+		while(position < bufferEnd) {
+			char *lineEnd = find(position, bufferEnd, '\n');
+			*lineEnd = '\0';
+
+			char *next;
+			const long originVertex = strtol(position, &next, 10);
+
+			if(next != position) {
+				while(true) {
+					position = next;
+					const long targetVertex = strtol(position, &next, 10);
+					if(next == position) {
+						break;
+					}
+
+					position = next;
+					const float edgeWeight = strtof(position, &next);
+					if(next == position) {
+						break;
+					}
+
+					const GraphBuilder::EdgeCheck check = GraphBuilder::checkEdge(
+						originVertex, targetVertex, edgeWeight, size);
+
+					if(check == GraphBuilder::kInvalidEdge) {
+						reader.invalid_edges_++;
+					}
+					else if(check == GraphBuilder::kSelfLoop) {
+						reader.self_loops_++;
+					}
+					else {
+						Edge e = {static_cast<int>(originVertex - 1),
+									 static_cast<int>(targetVertex - 1), edgeWeight};
+						reader.buckets_[partitionOf(e.from_, size, partitions)]
+							.push_back(e);
+					}
+				}
+			}
+
+			position = lineEnd + 1;
+		}
+	}
+
+	// Count the edges of each vertex of one partition, from every reader's
+	// bucket, into offsets[vertex + 1].
+	static void countPartition(const int partition, const vector<Reader> &readers,
+										vector<long> &offsets) {
+		GraphBuilder::countEdges(BucketEdges(readers, partition), offsets);
+	}
+
+	// Merge one partition's buckets from every reader (in file order) into the
+	// reserved runs of its vertices, keeping the first edge read between any
+	// pair of vertices and counting the rest in duplicates.
+	static void buildPartition(Graph &graph, const int firstVertex,
+										const int endVertex, const int partition,
+										const vector<Reader> &readers, long &duplicates) {
+		duplicates = GraphBuilder::fillVertices(graph, firstVertex, endVertex,
+															 BucketEdges(readers, partition));
+	}
+
+};
+
+#endif /* GraphLoader_h */
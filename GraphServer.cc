@@ -0,0 +1,694 @@
+/*
+File Name: GraphServer.cc
+Date Begun: 10/18/2026
+
+This file contains a long-running query server for the Graph class. The graph
+is loaded once, after which requests are read (one per line) from standard
+input or, if a socket path is given, from any number of concurrent clients of
+a local Unix domain socket. A single event loop polls every connection; all
+complete requests that arrive together, from every client, form a batch,
+which is answered by a pool of worker threads; shortest-path requests in a
+batch that share an origin vertex are answered from a single run of
+Dijkstra's algorithm. Each client's responses are written in its request
+order without blocking the loop, a client that disconnects before reading
+them is simply dropped, and per-request latency percentiles are reported on
+request and at shutdown.
+
+REQUESTS:
+* connected <from> <to>			Check if two vertices are connected.
+* path <from> <to>				Shortest path and cost between two vertices.
+* kpaths <from> <to> <k>		k shortest simple paths between two vertices.
+* nearest <from> <k>				The k vertices nearest a vertex.
+* radius <from> <distance>		All vertices within a distance of a vertex.
+* degrees							Degree information of the graph.
+* stats								Latency percentiles of requests answered so far.
+* quit								Close the connection (or end input).
+* shutdown							Stop the server.
+
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <poll.h>
+#include <sstream>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include "Graph.h"
+#include "GraphFiles.h"
+#include "KShortestPaths.h"
+using namespace std;
+
+typedef chrono::steady_clock Clock;
+
+// Fixed pool of worker threads which cooperatively run each batch of tasks.
+class WorkerPool {
+public:
+
+		// Constructor - start the worker threads.
+		// @numberOfWorkers	Number of threads in the pool (at least 1).
+		explicit WorkerPool(const int numberOfWorkers) : generation_{0},
+			tasks_{nullptr}, next_task_{0}, remaining_workers_{0},
+			stopping_{false} {
+			for(int i = 0; i < max(1, numberOfWorkers); i++) {
+				workers_.push_back(thread(&WorkerPool::workerLoop, this, i));
+			}
+		}
+
+		// Destructor - stop and join the worker threads.
+		~WorkerPool() {
+			{
+				lock_guard<mutex> lock(mutex_);
+				stopping_ = true;
+			}
+			wake_.notify_all();
+
+			for(size_t i = 0; i < workers_.size(); i++) {
+				workers_[i].join();
+			}
+		}
+
+		// @return		Number of threads in the pool.
+		int size() const {
+			return static_cast<int>(workers_.size());
+		}
+
+		// Run a batch of tasks across all workers and wait for completion.
+		// @tasks		Tasks to run; each is called with the index of the worker
+		//					(0 to size() - 1) running it.
+		void run(const vector<function<void(int)>> &tasks) {
+			unique_lock<mutex> lock(mutex_);
+			tasks_ = &tasks;
+			next_task_ = 0;
+			remaining_workers_ = size();
+			generation_++;
+			wake_.notify_all();
+
+			done_.wait(lock, [this] { return remaining_workers_ == 0; });
+			tasks_ = nullptr;
+		}
+
+private:
+
+	vector<thread> workers_;
+	mutex mutex_;
+	condition_variable wake_;
+	condition_variable done_;
+	long generation_;
+	const vector<function<void(int)>> *tasks_;
+	atomic<size_t> next_task_;
+	int remaining_workers_;
+	bool stopping_;
+
+	// Wait for each new batch, then claim and run tasks until none remain.
+	void workerLoop(const int worker) {
+		long seen = 0;
+
+		while(true) {
+			const vector<function<void(int)>> *tasks;
+			{
+				unique_lock<mutex> lock(mutex_);
+				wake_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+
+				if(stopping_) {
+					return;
+				}
+
+				seen = generation_;
+				tasks = tasks_;
+			}
+
+			for(size_t i = next_task_++; i < tasks->size(); i = next_task_++) {
+				(*tasks)[i](worker);
+			}
+
+			lock_guard<mutex> lock(mutex_);
+			if(--remaining_workers_ == 0) {
+				done_.notify_one();
+			}
+		}
+	}
+
+};
+
+// Server state: the resident Graph, its worker pool and latency record.
+class GraphServer {
+public:
+
+		// Constructor
+		// @graph					Loaded Graph to serve (taken over by the server).
+		// @numberOfWorkers		Number of worker threads.
+		GraphServer(Graph &&graph, const int numberOfWorkers) :
+			graph_{std::move(graph)}, degree_information_{
+			graph_.getDegreeInformation()}, pool_{numberOfWorkers},
+			states_(pool_.size(), Graph::SearchState(graph_.numberOfVertices())),
+			k_shortest_paths_(graph_, 1), k_paths_workspaces_(pool_.size()),
+			shutdown_{false} { }
+
+		// Serve requests read from a file descriptor until end of input, a quit
+		// request, or a shutdown request, writing responses to another.
+		// @input		File descriptor requests are read from.
+		// @output		File descriptor responses are written to.
+		void serve(const int input, const int output) {
+			connections_.push_back(Connection(input, output, false));
+			eventLoop(-1);
+		}
+
+		// Serve every client accepted on a listening socket, concurrently,
+		// until a shutdown request is received.
+		// @listener	Listening socket descriptor.
+		void serveListener(const int listener) {
+			eventLoop(listener);
+		}
+
+		// Utility for printing latency percentiles (microseconds) of all
+		// requests answered so far.
+		// @out			Stream to print to.
+		void outputLatencyInformation(ostream &out) {
+			vector<double> latencies;
+			{
+				lock_guard<mutex> lock(latency_mutex_);
+				latencies = latencies_;
+			}
+
+			out << "Requests: " << latencies.size() << endl;
+			if(latencies.empty()) {
+				return;
+			}
+
+			sort(latencies.begin(), latencies.end());
+			const double percentiles[] = {50.0, 90.0, 99.0, 100.0};
+			const char *labels[] = {"p50", "p90", "p99", "max"};
+
+			for(int i = 0; i < 4; i++) {
+				size_t rank = static_cast<size_t>(percentiles[i] / 100.0 *
+					latencies.size() + 0.5);
+				rank = min(max<size_t>(rank, 1), latencies.size());
+				out << labels[i] << " Latency (us): " << fixed << setprecision(1)
+					 << latencies[rank - 1] << endl;
+			}
+		}
+
+private:
+
+	// PRIVATE STRUCT - CONNECTION (a client's descriptors and buffers)
+	struct Connection {
+		int input_;
+		int output_;
+		bool socket_;			// Close the descriptor when done.
+		bool reading_;			// False after end of input or a quit request.
+		bool broken_;			// A write failed; the client is dropped.
+		string pending_;		// Input received after the last complete line.
+		string outbox_;		// Responses not yet written, from written_ on.
+		size_t written_;
+
+		Connection(const int input, const int output, const bool socket) :
+			input_{input}, output_{output}, socket_{socket}, reading_{true},
+			broken_{false}, written_{0} { }
+	};
+
+	// PRIVATE STRUCT - REQUEST (a request line and the client it came from)
+	struct Request {
+		size_t connection_;
+		string line_;
+	};
+
+	// Clients with more unwritten responses than this are not read from until
+	// they catch up.
+	static const size_t kMaxOutbox = 1 << 20;
+
+	Graph graph_;
+	const Graph::DegreeInformation degree_information_;
+	WorkerPool pool_;
+
+	// Per-worker search state, reused across requests (only the vertices a
+	// request touches are reset).
+	vector<Graph::SearchState> states_;
+
+	// Requests already run in parallel, so k shortest paths are searched on
+	// the calling worker alone, in that worker's reused workspace (allocated
+	// on its first kpaths request).
+	const KShortestPaths k_shortest_paths_;
+	vector<vector<KShortestPaths::Workspace>> k_paths_workspaces_;
+
+	mutex latency_mutex_;
+	vector<double> latencies_;
+	bool shutdown_;
+
+	vector<Connection> connections_;
+
+	// Poll the listener (if any) and every connection, accepting new clients,
+	// reading requests and writing responses as each is ready. All requests
+	// read in one round form one batch. Runs until a shutdown request, or
+	// (without a listener) until every connection is done.
+	// @listener	Listening socket descriptor; -1 if none.
+	void eventLoop(const int listener) {
+		char buffer[1 << 16];
+
+		while(!shutdown_ && (listener >= 0 || !connections_.empty())) {
+			// Slots in fds of each connection's input and output; -1 if unpolled.
+			vector<pollfd> fds;
+			vector<int> inputSlot(connections_.size(), -1);
+			vector<int> outputSlot(connections_.size(), -1);
+
+			if(listener >= 0) {
+				fds.push_back(pollfd{listener, POLLIN, 0});
+			}
+			for(size_t c = 0; c < connections_.size(); c++) {
+				const Connection &client = connections_[c];
+
+				if(client.reading_ && client.outbox_.size() < kMaxOutbox) {
+					inputSlot[c] = static_cast<int>(fds.size());
+					fds.push_back(pollfd{client.input_, POLLIN, 0});
+				}
+				if(client.outbox_.size() > client.written_) {
+					if(client.output_ == client.input_ && inputSlot[c] != -1) {
+						fds[inputSlot[c]].events |= POLLOUT;
+						outputSlot[c] = inputSlot[c];
+					}
+					else {
+						outputSlot[c] = static_cast<int>(fds.size());
+						fds.push_back(pollfd{client.output_, POLLOUT, 0});
+					}
+				}
+			}
+
+			if(poll(fds.data(), fds.size(), -1) < 0) {
+				if(errno == EINTR) {
+					continue;
+				}
+				break;
+			}
+			const Clock::time_point arrival = Clock::now();
+
+			// Read what each ready client has sent; every complete line is a
+			// request, up to a quit request.
+			vector<Request> batch;
+			for(size_t c = 0; c < connections_.size(); c++) {
+				Connection &client = connections_[c];
+				if(inputSlot[c] == -1 || !(fds[inputSlot[c]].revents &
+													(POLLIN | POLLHUP | POLLERR))) {
+					continue;
+				}
+
+				const ssize_t got = read(client.input_, buffer, sizeof(buffer));
+				if(got < 0 && (errno == EAGAIN || errno == EINTR)) {
+					continue;
+				}
+
+				if(got > 0) {
+					client.pending_.append(buffer, got);
+				}
+				else {
+					// End of input: a final request need not end in a newline.
+					client.pending_ += '\n';
+					client.reading_ = false;
+				}
+
+				size_t start = 0, end;
+				while((end = client.pending_.find('\n', start)) != string::npos) {
+					const string line = client.pending_.substr(start, end - start);
+					start = end + 1;
+
+					string command;
+					stringstream(line) >> command;
+					if(command == "quit") {
+						client.reading_ = false;
+						break;
+					}
+					if(!line.empty()) {
+						batch.push_back(Request{c, line});
+					}
+				}
+				client.pending_.erase(0, start);
+			}
+
+			if(!batch.empty()) {
+				handleBatch(batch, arrival);
+			}
+
+			for(size_t c = 0; c < connections_.size(); c++) {
+				flush(connections_[c]);
+			}
+
+			// Accept a new client, then drop clients that are done.
+			if(listener >= 0 && (fds[0].revents & POLLIN)) {
+				const int client = accept(listener, nullptr, nullptr);
+				if(client >= 0) {
+					fcntl(client, F_SETFL, fcntl(client, F_GETFL) | O_NONBLOCK);
+					connections_.push_back(Connection(client, client, true));
+				}
+			}
+
+			for(size_t c = connections_.size(); c > 0; c--) {
+				const Connection &client = connections_[c - 1];
+				if(client.broken_ ||
+					(!client.reading_ && client.outbox_.size() == client.written_)) {
+					disconnect(c - 1);
+				}
+			}
+		}
+
+		// On shutdown, write what each client will take, then disconnect all.
+		for(size_t c = connections_.size(); c > 0; c--) {
+			flush(connections_[c - 1]);
+			disconnect(c - 1);
+		}
+	}
+
+	// Write as much of a client's pending responses as it will take without
+	// blocking. A failed write (e.g. the client has gone) marks the client
+	// broken, to be dropped, rather than ending the server.
+	static void flush(Connection &client) {
+		while(!client.broken_ && client.written_ < client.outbox_.size()) {
+			const ssize_t wrote = write(client.output_,
+				client.outbox_.data() + client.written_,
+				client.outbox_.size() - client.written_);
+
+			if(wrote > 0) {
+				client.written_ += wrote;
+			}
+			else if(wrote < 0 && errno == EINTR) {
+				continue;
+			}
+			else if(wrote < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+				return;
+			}
+			else {
+				client.broken_ = true;
+			}
+		}
+
+		client.outbox_.clear();
+		client.written_ = 0;
+	}
+
+	// Close (if a socket) and forget a connection.
+	void disconnect(const size_t c) {
+		if(connections_[c].socket_) {
+			close(connections_[c].input_);
+		}
+		connections_.erase(connections_.begin() + c);
+	}
+
+	// Answer one batch of requests, in parallel, and queue each response to
+	// its client, in request order.
+	// @batch		Requests, from any number of clients.
+	// @arrival		Time at which the batch arrived.
+	void handleBatch(const vector<Request> &batch,
+						  const Clock::time_point arrival) {
+		vector<string> responses(batch.size());
+		vector<double> latencies(batch.size(), -1.0);
+		vector<function<void(int)>> tasks;
+		// Origin -> (request index, target) of each path request.
+		map<int, vector<pair<size_t, int>>> pathRequests;
+
+		for(size_t i = 0; i < batch.size(); i++) {
+			stringstream sLine(batch[i].line_);
+			string command;
+			int from(0), to(0), k(0);
+			float radius(0.0);
+			sLine >> command;
+
+			if(command.empty()) {
+				continue;
+			}
+			else if(command == "path" && sLine >> from >> to && isValid(from) &&
+					  isValid(to)) {
+				pathRequests[from].push_back(make_pair(i, to));
+			}
+			else if(command == "connected" && sLine >> from >> to &&
+					  isValid(from) && isValid(to)) {
+				tasks.push_back([=, &responses, &latencies](int) {
+					responses[i] = answerConnected(from, to);
+					latencies[i] = elapsed(arrival);
+				});
+			}
+			else if(command == "kpaths" && sLine >> from >> to >> k &&
+					  isValid(from) && isValid(to) && k >= 1) {
+				tasks.push_back([=, &responses, &latencies](int worker) {
+					responses[i] = answerKPaths(from, to, k, worker);
+					latencies[i] = elapsed(arrival);
+				});
+			}
+			else if(command == "nearest" && sLine >> from >> k && isValid(from)) {
+				tasks.push_back([=, &responses, &latencies](int worker) {
+					responses[i] = answerVertices(from,
+						graph_.nearest(from, k, states_[worker]));
+					latencies[i] = elapsed(arrival);
+				});
+			}
+			else if(command == "radius" && sLine >> from >> radius &&
+					  isValid(from)) {
+				tasks.push_back([=, &responses, &latencies](int worker) {
+					responses[i] = answerVertices(from,
+						graph_.withinRadius(from, radius, states_[worker]));
+					latencies[i] = elapsed(arrival);
+				});
+			}
+			else if(command == "degrees") {
+				responses[i] = answerDegrees();
+				latencies[i] = elapsed(arrival);
+			}
+			else if(command == "stats") {
+				stringstream out;
+				outputLatencyInformation(out);
+				responses[i] = out.str();
+			}
+			else if(command == "shutdown") {
+				shutdown_ = true;
+			}
+			else {
+				responses[i] = "Invalid request: " + batch[i].line_ + "\n";
+			}
+		}
+
+		// Path requests sharing an origin vertex share one Dijkstra run.
+		for(auto it = pathRequests.begin(); it != pathRequests.end(); it++) {
+			const int from = it->first;
+			const vector<pair<size_t, int>> &requests = it->second;
+
+			tasks.push_back([=, &responses, &latencies](int worker) {
+				// The search stops as soon as every target has been settled.
+				vector<int> targets;
+				for(size_t j = 0; j < requests.size(); j++) {
+					targets.push_back(requests[j].second - 1);
+				}
+				sort(targets.begin(), targets.end());
+				targets.erase(unique(targets.begin(), targets.end()), targets.end());
+				size_t remaining = targets.size();
+
+				graph_.search(from, states_[worker],
+					[](const int, const int, const float) { return true; },
+					[&](const int v, const float) {
+						if(binary_search(targets.begin(), targets.end(), v)) {
+							remaining--;
+						}
+						return remaining > 0;
+					});
+
+				for(size_t j = 0; j < requests.size(); j++) {
+					responses[requests[j].first] =
+						answerPath(from, requests[j].second, worker);
+					latencies[requests[j].first] = elapsed(arrival);
+				}
+			});
+		}
+
+		pool_.run(tasks);
+
+		for(size_t i = 0; i < responses.size(); i++) {
+			connections_[batch[i].connection_].outbox_ += responses[i];
+		}
+
+		lock_guard<mutex> lock(latency_mutex_);
+		for(size_t i = 0; i < latencies.size(); i++) {
+			if(latencies[i] >= 0.0) {
+				latencies_.push_back(latencies[i]);
+			}
+		}
+	}
+
+	// @return		Response to a connected request (as given by queryGraph).
+	string answerConnected(const int from, const int to) const {
+		stringstream out;
+		const float edgeWeight = graph_.isConnected(from, to);
+
+		out << from << " " << to;
+		if(from == to) {
+			out << ": Same vertex - implicit weight of 0";
+		}
+		else if(edgeWeight != -1.0) {
+			out << ": Connected, weight of edge is " << edgeWeight;
+		}
+		else {
+			out << ": Not connected";
+		}
+		out << endl;
+
+		return out.str();
+	}
+
+	// @return		Response to a path request, from the worker's search state
+	//					(path in the same form as Graph::dijkstra).
+	string answerPath(const int from, const int to, const int worker) const {
+		const Graph::SearchState &state = states_[worker];
+		stringstream out;
+
+		out << from << " " << to << ": ";
+		if(state.distance(to - 1) == INT_MAX) {
+			out << "Not reachable" << endl;
+			return out.str();
+		}
+
+		vector<int> path;
+		for(int v = to - 1; v != -1; v = state.previous(v)) {
+			path.push_back(v + 1);
+		}
+		for(size_t j = path.size(); j > 0; j--) {
+			out << path[j - 1] << (j > 1 ? ", " : "");
+		}
+		out << ", Cost: " << fixed << setprecision(1) << state.distance(to - 1)
+			 << endl;
+
+		return out.str();
+	}
+
+	// @return		Response to a nearest or radius request: the vertices found,
+	//					with their distances, in order of distance.
+	static string answerVertices(const int from,
+										  const vector<pair<int, float>> &found) {
+		stringstream out;
+
+		out << from << ":";
+		for(size_t j = 0; j < found.size(); j++) {
+			out << (j > 0 ? ", " : " ") << found[j].first << " (" << fixed
+				 << setprecision(1) << found[j].second << ")";
+		}
+		out << endl;
+
+		return out.str();
+	}
+
+	// @return		Response to a kpaths request: one line per path, in the
+	//					same form as a path request.
+	// @worker		Index of the calling worker, whose workspace is used.
+	// Pre-Condition:	from and to are valid vertex identities and k is at
+	//						least 1 (checked when the request is parsed, so an
+	//						empty result means to is unreachable).
+	string answerKPaths(const int from, const int to, const int k,
+							  const int worker) {
+		const vector<KShortestPaths::Path> paths =
+			k_shortest_paths_.find(from, to, k, k_paths_workspaces_[worker]);
+		stringstream out;
+
+		if(paths.empty()) {
+			out << from << " " << to << ": Not reachable" << endl;
+		}
+
+		for(size_t p = 0; p < paths.size(); p++) {
+			out << from << " " << to << ": ";
+			for(size_t j = 0; j < paths[p].vertices_.size(); j++) {
+				out << (j > 0 ? ", " : "") << paths[p].vertices_[j];
+			}
+			out << ", Cost: " << fixed << setprecision(1) << paths[p].cost_ << endl;
+		}
+
+		return out.str();
+	}
+
+	// @return		Response to a degrees request.
+	string answerDegrees() const {
+		stringstream out;
+
+		out << "Number of Undirected Edges: " << degree_information_.numberOfEdges
+			 << ", Smallest Degree: " << degree_information_.smallestDegree
+			 << ", Largest Degree: " << degree_information_.largestDegree
+			 << ", Average Degree: " << fixed << setprecision(1)
+			 << degree_information_.averageDegree << endl;
+
+		return out.str();
+	}
+
+	// @return		True if identity is a valid vertex identity of the Graph.
+	bool isValid(const int identity) const {
+		return identity >= 1 && identity <= graph_.numberOfVertices();
+	}
+
+	// @return		Microseconds elapsed since start.
+	static double elapsed(const Clock::time_point start) {
+		return chrono::duration<double, micro>(Clock::now() - start).count();
+	}
+
+};
+
+// Function for serving clients of a Unix domain socket, all concurrently,
+// until a shutdown request is received.
+// @server			Loaded GraphServer.
+// @socket_path	Path at which to create the socket.
+void serveSocket(GraphServer &server, const string socket_path) {
+	const int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+	sockaddr_un address;
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+	unlink(socket_path.c_str());
+
+	if(listener < 0 ||
+		bind(listener, reinterpret_cast<sockaddr *>(&address),
+			  sizeof(address)) < 0 || listen(listener, 16) < 0) {
+		cout << "Cannot listen on " << socket_path << endl;
+		exit(1);
+	}
+
+	server.serveListener(listener);
+
+	close(listener);
+	unlink(socket_path.c_str());
+}
+
+// Main function for the graph query server.
+int main(int argc, char **argv) {
+	if(argc != 3 && argc != 4) {
+		cout << "Usage: " << argv[0] << " <graphtxtfilename> <#ofWorkers>"
+			  << " [socketpath]" << endl << endl;
+		return 0;
+	}
+
+	const string graph_filename(argv[1]);
+	const int numberOfWorkers(stoi(argv[2], nullptr));
+
+	// A client that goes away before reading its responses must not end the
+	// server: failed writes are reported as errors instead of SIGPIPE.
+	signal(SIGPIPE, SIG_IGN);
+
+	// Load Graph once and start serving
+	GraphServer server(createGraph(graph_filename), numberOfWorkers);
+
+	if(argc == 4) {
+		serveSocket(server, argv[3]);
+	}
+	else {
+		server.serve(STDIN_FILENO, STDOUT_FILENO);
+	}
+
+	// Report latency percentiles of all requests answered
+	server.outputLatencyInformation(cerr);
+
+	return 0;
+}
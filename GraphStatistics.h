@@ -0,0 +1,440 @@
+/*
+File Name: GraphStatistics.h
+Date Begun: 10/18/2026
+
+This header file contains the interface and implementation (for ease of
+compilation) of the GraphStatistics class, which computes the degree and
+weight statistics of a Graph in one pass: full out-degree and in-degree
+distributions (histograms, from which any percentile can be read), the
+smallest, largest and average edge weight, and the number of self-loops and
+duplicate edges dropped while the Graph was built.
+
+Vertices are divided into contiguous ranges, one per thread. When the Graph
+holds its edges packed in vertex order (as built, loaded, copied or compacted
+Graphs do), each thread reads its out-degrees straight from the packed
+offsets and scans the weights of its whole range as one array, four at a
+time with SSE2 (where available; otherwise one at a time), masking out
+removed edges; otherwise it reads each vertex's runs in turn. In-degrees are
+counted without shared counters: each thread counts the targets of its
+vertices' edges into counts of its own, one range of targets at a time (to
+bound their memory), after which the counts of each target are summed and
+binned in a second parallel pass. The per-thread results are then merged.
+
+PUBLIC OPERATIONS:
+* compute()							Return the statistics of the Graph.
+* outputStatistics()				Print a summary of the statistics.
+
+*/
+
+#ifndef GraphStatistics_h
+#define GraphStatistics_h
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "Graph.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+using namespace std;
+
+class GraphStatistics {
+public:
+
+		// PUBLIC STRUCT - DEGREEDISTRIBUTION
+		struct DegreeDistribution {
+			int smallest_;
+			int largest_;
+			double average_;
+			vector<long> histogram_; // Number of vertices of each degree.
+
+			// @return		Smallest degree at least p percent of the vertices
+			//					have (nearest rank); 0 if there are no vertices.
+			// @p				Percentile, between 0 and 100.
+			int percentile(const double p) const {
+				long total = 0;
+				for(size_t d = 0; d < histogram_.size(); d++) {
+					total += histogram_[d];
+				}
+
+				const long rank = max(1L, static_cast<long>(
+					ceil(min(100.0, max(0.0, p)) / 100.0 * total)));
+				long seen = 0;
+				for(size_t d = 0; d < histogram_.size(); d++) {
+					seen += histogram_[d];
+					if(seen >= rank) {
+						return static_cast<int>(d);
+					}
+				}
+
+				return 0;
+			}
+		};
+
+		// PUBLIC STRUCT - STATISTICS
+		struct Statistics {
+			int numberOfVertices_;
+			long numberOfEdges_;		// Directed edges, excluding removed ones.
+			DegreeDistribution outDegree_;
+			DegreeDistribution inDegree_;
+			float smallestWeight_;	// Weights are 0.0 if there are no edges.
+			float largestWeight_;
+			double averageWeight_;
+			long selfLoops_;			// Dropped while the Graph was built.
+			long duplicateEdges_;	// Dropped while the Graph was built.
+		};
+
+		// Constructor
+		// @graph					Graph to analyze (must outlive this object).
+		// @numberOfThreads		Number of threads to scan vertices on; 0 selects
+		//								the number of hardware threads.
+		explicit GraphStatistics(const Graph &graph,
+										 const int numberOfThreads = 0) :
+			graph_(graph), number_of_threads_{numberOfThreads > 0 ?
+				numberOfThreads :
+				max(1, static_cast<int>(thread::hardware_concurrency()))} { }
+
+		// Compute the degree and weight statistics of the Graph.
+		// @return				Statistics of the Graph.
+		Statistics compute() const {
+			const int size = graph_.numberOfVertices();
+			const int threads = max(1, min(number_of_threads_, size));
+			vector<Workspace> workspaces(threads);
+
+			// Out-degrees and weights of each range.
+			inParallel(threads, size, [&](const int t, const int first,
+													const int end) {
+				Workspace &workspace = workspaces[t];
+
+				if(isPacked()) {
+					const vector<long> &offsets = graph_.packed_offsets_;
+					for(int v = first; v < end; v++) {
+						bin(workspace.out_degrees_,
+							 static_cast<int>(offsets[v + 1] - offsets[v]) -
+							 (graph_.dead_edges_ > 0 ?
+								 graph_.graph_vertices_[v].dead_edges_ : 0));
+					}
+
+					scanWeights(graph_.weight_blocks_[0].get() + offsets[first],
+									offsets[end] - offsets[first], workspace);
+				}
+				else {
+					for(int v = first; v < end; v++) {
+						const Graph::Vertex &opV = graph_.graph_vertices_[v];
+						bin(workspace.out_degrees_,
+							 static_cast<int>(opV.adjacent_vertices_.size()) -
+							 opV.dead_edges_);
+						scanWeights(opV.edge_weights_.data(),
+										opV.edge_weights_.size(), workspace);
+					}
+				}
+			});
+
+			// In-degrees, one range of targets at a time: each thread counts
+			// the targets of its vertices' edges, then each thread sums and
+			// bins the counts of its share of the targets.
+			for(int low = 0; low < size; low += kTargetRange) {
+				const int high = min(size, low + kTargetRange);
+
+				inParallel(threads, size, [&](const int t, const int first,
+														const int end) {
+					countTargets(first, end, low, high, workspaces[t].in_counts_);
+				});
+
+				inParallel(threads, high - low, [&](const int t, const int first,
+																const int end) {
+					for(int i = first; i < end; i++) {
+						int degree = 0;
+						for(int u = 0; u < threads; u++) {
+							degree += workspaces[u].in_counts_[i];
+						}
+						bin(workspaces[t].in_degrees_, degree);
+					}
+				});
+			}
+
+			// Merge the per-thread results.
+			Statistics statistics;
+			statistics.numberOfVertices_ = size;
+			statistics.numberOfEdges_ = 0;
+			statistics.selfLoops_ = graph_.self_loops_;
+			statistics.duplicateEdges_ = graph_.duplicate_edges_;
+
+			vector<long> outDegrees, inDegreeCounts;
+			float smallest = 0.0, largest = 0.0;
+			double sum = 0.0;
+			long weights = 0;
+
+			for(int t = 0; t < threads; t++) {
+				const Workspace &workspace = workspaces[t];
+
+				merge(outDegrees, workspace.out_degrees_);
+				merge(inDegreeCounts, workspace.in_degrees_);
+
+				if(workspace.weights_ > 0) {
+					smallest = weights > 0 ?
+						min(smallest, workspace.smallest_weight_) :
+						workspace.smallest_weight_;
+					largest = weights > 0 ?
+						max(largest, workspace.largest_weight_) :
+						workspace.largest_weight_;
+					sum += workspace.weight_sum_;
+					weights += workspace.weights_;
+				}
+			}
+
+			statistics.outDegree_ = distribution(outDegrees);
+			for(size_t d = 0; d < outDegrees.size(); d++) {
+				statistics.numberOfEdges_ += outDegrees[d] * static_cast<long>(d);
+			}
+			statistics.inDegree_ = distribution(inDegreeCounts);
+			statistics.smallestWeight_ = smallest;
+			statistics.largestWeight_ = largest;
+			statistics.averageWeight_ = weights > 0 ? sum / weights : 0.0;
+
+			return statistics;
+		}
+
+		// Print a summary of the degree and weight statistics of the Graph.
+		void outputStatistics() const {
+			const Statistics statistics = compute();
+
+			cout << "Number of Vertices: " << statistics.numberOfVertices_ << endl;
+			cout << "Number of Directed Edges: " << statistics.numberOfEdges_
+				  << endl;
+			outputDistribution("Out-Degree", statistics.outDegree_);
+			outputDistribution("In-Degree", statistics.inDegree_);
+			cout << "Edge Weight: Smallest " << fixed << setprecision(1)
+				  << statistics.smallestWeight_ << ", Largest "
+				  << statistics.largestWeight_ << ", Average " << setprecision(3)
+				  << statistics.averageWeight_ << endl;
+			cout << "Self-Loops Dropped: " << statistics.selfLoops_ << endl;
+			cout << "Duplicate Edges Dropped: " << statistics.duplicateEdges_
+				  << endl << endl;
+		}
+
+private:
+
+	// PRIVATE STRUCT - WORKSPACE (partial results of a thread)
+	struct Workspace {
+		vector<long> out_degrees_;
+		vector<long> in_degrees_;
+		vector<int> in_counts_; // Edges into each target of the current range.
+		float smallest_weight_;
+		float largest_weight_;
+		double weight_sum_;
+		long weights_;
+
+		Workspace() : smallest_weight_{0.0}, largest_weight_{0.0},
+			weight_sum_{0.0}, weights_{0} { }
+	};
+
+	// Targets whose in-degrees are counted at a time, which bounds each
+	// thread's counts to 4 MB.
+	static const int kTargetRange = 1 << 20;
+
+	const Graph &graph_;
+	int number_of_threads_;
+
+
+	/*
+	*****************************************************************************
+	****************************PRIVATE FUNCTIONS********************************
+	*****************************************************************************
+	*/
+
+	// Run f(t, first, end) on each of a number of threads, where [first, end)
+	// is thread t's contiguous share of the indices [0, size), and wait for
+	// all.
+	template <typename Function>
+	static void inParallel(const int threads, const int size, Function f) {
+		vector<thread> workers;
+
+		for(int t = 0; t < threads; t++) {
+			workers.push_back(thread(f, t,
+				static_cast<int>(static_cast<long>(size) * t / threads),
+				static_cast<int>(static_cast<long>(size) * (t + 1) / threads)));
+		}
+		for(size_t t = 0; t < workers.size(); t++) {
+			workers[t].join();
+		}
+	}
+
+	// @return		True if every vertex's edges are packed back to back in the
+	//					first edge block (see Graph::packed_offsets_).
+	bool isPacked() const {
+		return !graph_.packed_offsets_.empty() &&
+			!graph_.target_blocks_.empty();
+	}
+
+	// Count the live edges from a range of vertices into each target of a
+	// range of targets.
+	// @first, end		Range of origin indices.
+	// @low, high		Range of target indices.
+	// @counts			Set to the number of edges into each target, from low.
+	void countTargets(const int first, const int end, const int low,
+							const int high, vector<int> &counts) const {
+		counts.assign(high - low, 0);
+		const unsigned range = static_cast<unsigned>(high - low);
+		const bool removed = graph_.dead_edges_ > 0;
+
+		if(isPacked()) {
+			const vector<long> &offsets = graph_.packed_offsets_;
+			const int *targets = graph_.target_blocks_[0].get();
+			const float *weights = graph_.weight_blocks_[0].get();
+
+			for(long i = offsets[first]; i < offsets[end]; i++) {
+				const unsigned target = static_cast<unsigned>(targets[i] - low);
+				if(target < range && (!removed || weights[i] >= 0.0)) {
+					counts[target]++;
+				}
+			}
+			return;
+		}
+
+		for(int v = first; v < end; v++) {
+			const Graph::Vertex &opV = graph_.graph_vertices_[v];
+			for(size_t i = 0; i < opV.adjacent_vertices_.size(); i++) {
+				const unsigned target =
+					static_cast<unsigned>(opV.adjacent_vertices_[i] - low);
+				if(target < range && opV.edge_weights_[i] >= 0.0) {
+					counts[target]++;
+				}
+			}
+		}
+	}
+
+	// Count one vertex of a degree in a histogram, growing it as needed.
+	static void bin(vector<long> &histogram, const int degree) {
+		if(degree >= static_cast<int>(histogram.size())) {
+			histogram.resize(degree + 1, 0);
+		}
+		histogram[degree]++;
+	}
+
+	// Add one histogram into another, growing it as needed.
+	static void merge(vector<long> &total, const vector<long> &histogram) {
+		if(histogram.size() > total.size()) {
+			total.resize(histogram.size(), 0);
+		}
+		for(size_t d = 0; d < histogram.size(); d++) {
+			total[d] += histogram[d];
+		}
+	}
+
+	// @return		Smallest, largest and average degree of a histogram.
+	static DegreeDistribution distribution(const vector<long> &histogram) {
+		DegreeDistribution result;
+		result.histogram_ = histogram;
+		result.smallest_ = 0;
+		result.largest_ = 0;
+		result.average_ = 0.0;
+
+		long vertices = 0, total = 0;
+		for(size_t d = 0; d < histogram.size(); d++) {
+			if(histogram[d] > 0) {
+				if(vertices == 0) {
+					result.smallest_ = static_cast<int>(d);
+				}
+				result.largest_ = static_cast<int>(d);
+			}
+			vertices += histogram[d];
+			total += histogram[d] * static_cast<long>(d);
+		}
+
+		if(vertices > 0) {
+			result.average_ = static_cast<double>(total) / vertices;
+		}
+		return result;
+	}
+
+	// Add an array of edge weights to a thread's smallest, largest, sum and
+	// count of weights, skipping removed edges (negative weights); with SSE2
+	// four weights are taken at a time, removed ones masked out.
+	// @weights		Edge weights, packed.
+	// @count		Number of weights.
+	static void scanWeights(const float *weights, const long count,
+									Workspace &workspace) {
+		float smallest = INFINITY, largest = -INFINITY;
+		double sum = 0.0;
+		long scanned = 0;
+		long i = 0;
+
+#if defined(__SSE2__)
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 positive = _mm_set1_ps(INFINITY);
+		const __m128 negative = _mm_set1_ps(-INFINITY);
+		__m128 low = positive, high = negative;
+		__m128d sumLow = _mm_setzero_pd(), sumHigh = _mm_setzero_pd();
+
+		for(; i + 4 <= count; i += 4) {
+			const __m128 block = _mm_loadu_ps(weights + i);
+			const __m128 live = _mm_cmpge_ps(block, zero);
+			const __m128 kept = _mm_and_ps(live, block); // 0.0 where removed.
+			const int mask = _mm_movemask_ps(live);
+
+			low = _mm_min_ps(low,
+								  _mm_or_ps(kept, _mm_andnot_ps(live, positive)));
+			high = _mm_max_ps(high,
+									_mm_or_ps(kept, _mm_andnot_ps(live, negative)));
+			sumLow = _mm_add_pd(sumLow, _mm_cvtps_pd(kept));
+			sumHigh = _mm_add_pd(sumHigh,
+										_mm_cvtps_pd(_mm_movehl_ps(kept, kept)));
+			scanned += (mask & 1) + (mask >> 1 & 1) + (mask >> 2 & 1) +
+				(mask >> 3);
+		}
+
+		float lows[4], highs[4];
+		double sums[2];
+		_mm_storeu_ps(lows, low);
+		_mm_storeu_ps(highs, high);
+		_mm_storeu_pd(sums, _mm_add_pd(sumLow, sumHigh));
+
+		for(int lane = 0; lane < 4; lane++) {
+			smallest = min(smallest, lows[lane]);
+			largest = max(largest, highs[lane]);
+		}
+		sum = sums[0] + sums[1];
+#endif
+
+		for(; i < count; i++) {
+			if(weights[i] >= 0.0) {
+				smallest = min(smallest, weights[i]);
+				largest = max(largest, weights[i]);
+				sum += weights[i];
+				scanned++;
+			}
+		}
+
+		if(scanned == 0) {
+			return;
+		}
+
+		if(workspace.weights_ == 0) {
+			workspace.smallest_weight_ = smallest;
+			workspace.largest_weight_ = largest;
+		}
+		else {
+			workspace.smallest_weight_ = min(workspace.smallest_weight_, smallest);
+			workspace.largest_weight_ = max(workspace.largest_weight_, largest);
+		}
+		workspace.weight_sum_ += sum;
+		workspace.weights_ += scanned;
+	}
+
+	// Print a degree distribution with its median and high percentiles.
+	static void outputDistribution(const char *name,
+											 const DegreeDistribution &degrees) {
+		cout << name << ": Smallest " << degrees.smallest_ << ", Largest "
+			  << degrees.largest_ << ", Average " << fixed << setprecision(1)
+			  << degrees.average_ << ", Median " << degrees.percentile(50)
+			  << ", 90th Percentile " << degrees.percentile(90)
+			  << ", 99th Percentile " << degrees.percentile(99) << endl;
+	}
+
+};
+
+#endif /* GraphStatistics_h */
@@ -0,0 +1,239 @@
+/*
+File Name: GraphView.h
+Date Begun: 10/18/2026
+
+This header file contains the interface and implementation (for ease of
+compilation) of the GraphView class, a lightweight filtered view of a shared
+Graph: a subset of its vertices, a range of edge weights and any further mask
+of edges. A view never copies the Graph; it holds a Handle to it (see
+Graph::share) and an edge filter, which queries pass to the Graph's own
+algorithms (see Graph::shortestPaths and Graph::search). Views are cheap to
+copy and to narrow further, and any number may share one Graph.
+
+PUBLIC OPERATIONS:
+* withVertices(identities)			Narrow the view to a subset of vertices.
+* withVertexMask(mask)				Narrow the view to the vertices of a mask.
+* withWeights(lowest, highest)	Narrow the view to edges in a weight range.
+* withEdgeMask(mask)					Narrow the view to edges a function accepts.
+* contains(identity)					Check if a vertex is in the view.
+* isConnected(from, to)				Check if two vertices are connected.
+* shortestPaths(from, distance, previous)
+											Run Dijkstra's algorithm within the view.
+* search(from, state, visit)		Incremental Dijkstra search within the view.
+* dijkstra(from)						Output all path information within the view.
+* graph(), filter()					The underlying Graph and the view's edge
+											filter, for running other algorithms.
+
+*/
+
+#ifndef GraphView_h
+#define GraphView_h
+
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits.h>
+#include <memory>
+#include <vector>
+#include "Graph.h"
+using namespace std;
+
+class GraphView {
+public:
+
+		// PUBLIC TYPE - EDGEMASK
+		// Called as mask(from, to, weight) with the identities of an edge's
+		// origin and target and its weight; the edge is in the view only if it
+		// returns true.
+		typedef function<bool(int, int, float)> EdgeMask;
+
+		// PUBLIC CLASS - FILTER (the view's edge filter, as for Graph::search)
+		class Filter {
+		public:
+
+				Filter() : lowest_weight_(0.0), highest_weight_(INT_MAX) { }
+
+				// @return	True if the edge from index v to index w with the given
+				//				weight is in the view.
+				bool operator()(const int v, const int w, const float weight) const {
+					return weight >= lowest_weight_ && weight <= highest_weight_ &&
+						(!vertices_ || ((*vertices_)[v] && (*vertices_)[w])) &&
+						(!edges_ || (*edges_)(v + 1, w + 1, weight));
+				}
+
+		private:
+
+			shared_ptr<const vector<bool>> vertices_;	// By index; null if all.
+			float lowest_weight_;
+			float highest_weight_;
+			shared_ptr<const EdgeMask> edges_;			// Null if all.
+
+			friend class GraphView;
+		};
+
+		// Constructor - a view of a whole Graph.
+		// @graph		Handle to the Graph to view.
+		explicit GraphView(const Graph::Handle &graph) : graph_{graph} { }
+
+		// @return		This view narrowed to the given vertices.
+		// @identities	Identities (integers) of the vertices to keep; invalid
+		//					identities are ignored.
+		GraphView withVertices(const vector<int> &identities) const {
+			vector<bool> mask(graph_->numberOfVertices(), false);
+			for(size_t i = 0; i < identities.size(); i++) {
+				if(identities[i] >= 1 && identities[i] <= graph_->numberOfVertices()) {
+					mask[identities[i] - 1] = true;
+				}
+			}
+
+			return withVertexMask(mask);
+		}
+
+		// @return		This view narrowed to the vertices of a mask.
+		// @mask			Whether to keep each vertex, indexed by identity - 1.
+		GraphView withVertexMask(const vector<bool> &mask) const {
+			shared_ptr<vector<bool>> vertices =
+				make_shared<vector<bool>>(graph_->numberOfVertices(), false);
+			for(size_t i = 0; i < mask.size() && i < vertices->size(); i++) {
+				(*vertices)[i] = mask[i] && contains(static_cast<int>(i) + 1);
+			}
+
+			GraphView view(*this);
+			view.filter_.vertices_ = vertices;
+			return view;
+		}
+
+		// @return		This view narrowed to edges with weights in a range.
+		// @lowest		Lowest edge weight to keep.
+		// @highest		Highest edge weight to keep.
+		GraphView withWeights(const float lowest, const float highest) const {
+			GraphView view(*this);
+			view.filter_.lowest_weight_ = max(filter_.lowest_weight_, lowest);
+			view.filter_.highest_weight_ = min(filter_.highest_weight_, highest);
+			return view;
+		}
+
+		// @return		This view narrowed to the edges a mask accepts (as well as
+		//					any it was already narrowed by).
+		// @mask			Edge mask; see EdgeMask.
+		GraphView withEdgeMask(const EdgeMask &mask) const {
+			GraphView view(*this);
+			const shared_ptr<const EdgeMask> previous = filter_.edges_;
+
+			view.filter_.edges_ = make_shared<const EdgeMask>(
+				[previous, mask](const int from, const int to, const float weight) {
+					return (!previous || (*previous)(from, to, weight)) &&
+						mask(from, to, weight);
+				});
+			return view;
+		}
+
+		// @return		True if a vertex identity is valid and in the view.
+		bool contains(const int identity) const {
+			return identity >= 1 && identity <= graph_->numberOfVertices() &&
+				(!filter_.vertices_ || (*filter_.vertices_)[identity - 1]);
+		}
+
+		// Check for an edge between two vertices within the view.
+		// @return		Weight (float) of the edge if it is in the view; else
+		//					sentinel value of -1.0, as for Graph::isConnected.
+		float isConnected(const int from, const int to) const {
+			const float weight = graph_->isConnected(from, to);
+
+			if(weight == -1.0 || !filter_(from - 1, to - 1, weight)) {
+				return -1.0;
+			}
+			return weight;
+		}
+
+		// Computes shortest paths from an origin vertex within the view; see
+		// Graph::shortestPaths. Vertices outside the view are unreachable.
+		// Pre-Condition:	from is in the view. This is checked in the
+		//						function.
+		void shortestPaths(const int from, vector<float> &distance,
+								 vector<int> &previous) const {
+			if(!checkVertex(from)) {
+				distance.assign(graph_->numberOfVertices(), INT_MAX);
+				previous.assign(graph_->numberOfVertices(), -1);
+				return;
+			}
+
+			graph_->shortestPaths(from, distance, previous, 0, filter_);
+		}
+
+		// Incremental Dijkstra search within the view; see Graph::search.
+		// Pre-Condition:	from is in the view. This is checked in the
+		//						function.
+		template <typename Visitor>
+		void search(const int from, Graph::SearchState &state,
+						Visitor visit) const {
+			if(checkVertex(from)) {
+				graph_->search(from, state, filter_, visit);
+			}
+		}
+
+		// Run Dijkstra's algorithm within the view and output the path to and
+		// distance of every vertex in it, in the same format as Graph::dijkstra.
+		// Pre-Condition:	from is in the view. This is checked in the
+		//						function.
+		void dijkstra(const int from) const {
+			if(!checkVertex(from)) {
+				return;
+			}
+
+			vector<float> distance;
+			vector<int> previous;
+			shortestPaths(from, distance, previous);
+
+			vector<int> path;
+			for(int i = 0; i < graph_->numberOfVertices(); i++) {
+				if(!contains(i + 1)) {
+					continue;
+				}
+
+				path.clear();
+				for(int v = i; v != -1; v = previous[v]) {
+					path.push_back(v + 1);
+				}
+
+				cout << i + 1 << ": ";
+				for(size_t j = path.size(); j > 0; j--) {
+					cout << path[j - 1] << (j > 1 ? ", " : "");
+				}
+				cout << ", Cost: " << fixed << setprecision(1) << distance[i];
+				cout << endl;
+			}
+		}
+
+		// @return		The viewed Graph.
+		const Graph &graph() const {
+			return *graph_;
+		}
+
+		// @return		The view's edge filter, to run any filtered Graph algorithm
+		//					within the view.
+		const Filter &filter() const {
+			return filter_;
+		}
+
+private:
+
+	Graph::Handle graph_;
+	Filter filter_;
+
+	// Check for a vertex selection within the view.
+	// @return		True if identity is in the view; else false, with a message.
+	bool checkVertex(const int identity) const {
+		if(!contains(identity)) {
+			cout << "Invalid vertex selection! Please provide a selection "
+				  << "in the view, between 1 and " << graph_->numberOfVertices()
+				  << endl << endl;
+			return false;
+		}
+
+		return true;
+	}
+
+};
+
+#endif /* GraphView_h */
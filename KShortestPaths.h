@@ -0,0 +1,401 @@
+/*
+File Name: KShortestPaths.h
+Date Begun: 10/18/2026
+
+This header file contains the interface and implementation (for ease of
+compilation) of the KShortestPaths class, which finds the k shortest simple
+(loopless) paths between two vertices of a Graph with Yen's algorithm.
+
+The first path is found by a search from the origin that stops as soon as the
+target is settled. Each later path is found by "spur" searches from every
+vertex of the previous path, from the point where that path deviated from its
+parent onwards (Lawler's refinement; earlier spur vertices would only repeat
+candidates). Spur searches run on the Graph's incremental Dijkstra search with
+the root path's vertices and the already used edges masked out by a filter
+rather than removed from a copy of the Graph, stop as soon as the target is
+settled (resetting only the vertices they touched), and are run in parallel
+on helper threads started once per find() and woken for each round. The
+search ends as soon as k paths have been confirmed.
+
+No shortest-path tree is kept and reused between these searches: every spur
+search is a fresh bounded Dijkstra search. A tree usable by every spur (a
+reverse tree to the target, giving each spur vertex's remaining distance)
+would take a full search of the whole Graph per query, over a reversed copy
+of it, while the bounded searches explore only the region up to the target.
+
+Each thread searches in its own Workspace. Callers answering many queries
+(e.g. GraphServer) keep their Workspaces and pass them to every find(), so a
+query costs time proportional to the region its searches explore rather than
+to the size of the Graph.
+
+PUBLIC OPERATIONS:
+* find(from, to, k[, workspaces])	Return up to k shortest simple paths.
+* outputPaths(from, to, k)				Print up to k shortest simple paths.
+
+*/
+
+#ifndef KShortestPaths_h
+#define KShortestPaths_h
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits.h>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+#include "Graph.h"
+using namespace std;
+
+class KShortestPaths {
+public:
+
+		// PUBLIC STRUCT - PATH
+		// Vertices are identities (integers) from origin to target, in the same
+		// order as printed by Graph::dijkstra.
+		struct Path {
+			float cost_;
+			vector<int> vertices_;
+		};
+
+		// PUBLIC STRUCT - WORKSPACE
+		// Search state and masks of one thread, reusable across find() calls.
+		// Masks are always left cleared and search state is reset in O(1)
+		// (see Graph::SearchState).
+		struct Workspace {
+			Graph::SearchState state_;
+			vector<bool> banned_vertex_;
+			vector<bool> banned_edge_; // Targets of masked edges from the spur.
+
+			explicit Workspace(const int size) : state_(size),
+				banned_vertex_(size, false), banned_edge_(size, false) { }
+		};
+
+		// Constructor
+		// @graph					Graph to search (must outlive this object).
+		// @numberOfThreads		Number of threads for spur searches; 0 selects
+		//								the number of hardware threads.
+		explicit KShortestPaths(const Graph &graph, const int numberOfThreads = 0) :
+			graph_(graph), number_of_threads_{numberOfThreads > 0 ?
+				numberOfThreads :
+				max(1, static_cast<int>(thread::hardware_concurrency()))} { }
+
+		// Find the k shortest simple paths between two vertices.
+		// @from					Identity (integer) of the origin vertex.
+		// @to					Identity (integer) of the target vertex.
+		// @k						Number of paths wanted.
+		// @return				Up to k paths, in non-decreasing order of cost; fewer
+		//							if fewer simple paths exist (none if to is
+		//							unreachable or the input is invalid).
+		// Pre-Condition:		from and to are valid vertex identities. This is
+		//							checked in the function.
+		vector<Path> find(const int from, const int to, const int k) const {
+			vector<Workspace> workspaces;
+			return find(from, to, k, workspaces);
+		}
+
+		// As above, but searching in caller-owned workspaces, one per thread,
+		// so that repeated queries do not allocate O(V) state each time.
+		// @workspaces			Workspaces to search in; grown (only) to the
+		//							number of threads on first use and left ready
+		//							for the next call. Must not be shared by
+		//							concurrent calls.
+		vector<Path> find(const int from, const int to, const int k,
+								vector<Workspace> &workspaces) const {
+			vector<Path> accepted;
+			const int size = graph_.numberOfVertices();
+
+			// Check valid input
+			if(from < 1 || from > size || to < 1 || to > size) {
+				cout << "Invalid vertex selections! Please provide selections "
+					  << "between 1 and " << size << endl << endl;
+				return accepted;
+			}
+
+			if(k <= 0) {
+				return accepted;
+			}
+
+			if(static_cast<int>(workspaces.size()) < number_of_threads_) {
+				workspaces.resize(number_of_threads_, Workspace(size));
+			}
+
+			// The first path comes from a search that stops at the target.
+			Graph::SearchState &state = workspaces[0].state_;
+			graph_.search(from, state,
+				[](const int, const int, const float) { return true; },
+				[&](const int v, const float) { return v != to - 1; });
+
+			if(state.distance(to - 1) == INT_MAX) {
+				return accepted;
+			}
+
+			Path first;
+			for(int v = to - 1; v != -1; v = state.previous(v)) {
+				first.vertices_.push_back(v + 1);
+			}
+			reverse(first.vertices_.begin(), first.vertices_.end());
+			first.cost_ = pathCost(first.vertices_);
+
+			accepted.push_back(first);
+			vector<int> deviations(1, 0);
+
+			set<Candidate> candidates;
+			set<vector<int>> seen;
+			seen.insert(first.vertices_);
+
+			if(k == 1) {
+				return accepted;
+			}
+
+			// Spur searches of the current round; every thread claims spur
+			// indices from next until all are taken.
+			const Path *previousPath = nullptr;
+			int firstSpur = 0, spurCount = 0;
+			vector<Path> spurPaths;
+			atomic<int> next(0);
+
+			SpurThreads threads(number_of_threads_ - 1, [&](const int t) {
+				for(int i = next.fetch_add(1); i < spurCount;
+					 i = next.fetch_add(1)) {
+					spurPaths[i] = spurSearch(*previousPath, firstSpur + i,
+													  accepted, to, workspaces[t]);
+				}
+			});
+
+			while(static_cast<int>(accepted.size()) < k) {
+				previousPath = &accepted.back();
+				firstSpur = deviations.back();
+				spurCount = max(0, static_cast<int>(
+					previousPath->vertices_.size()) - 1 - firstSpur);
+				spurPaths.assign(spurCount, Path());
+				next = 0;
+
+				// Run the spur searches of the previous path in parallel.
+				threads.run();
+
+				for(int i = 0; i < spurCount; i++) {
+					if(!spurPaths[i].vertices_.empty() &&
+						seen.insert(spurPaths[i].vertices_).second) {
+						Candidate c;
+						c.path_ = spurPaths[i];
+						c.deviation_ = firstSpur + i;
+						candidates.insert(c);
+					}
+				}
+
+				if(candidates.empty()) {
+					break;
+				}
+
+				// Confirm the cheapest candidate as the next shortest path.
+				accepted.push_back(candidates.begin()->path_);
+				deviations.push_back(candidates.begin()->deviation_);
+				candidates.erase(candidates.begin());
+			}
+
+			return accepted;
+		}
+
+		// Print up to k shortest simple paths between two vertices, one per
+		// line, in the same form as Graph::dijkstra.
+		// @from					Identity (integer) of the origin vertex.
+		// @to					Identity (integer) of the target vertex.
+		// @k						Number of paths wanted.
+		void outputPaths(const int from, const int to, const int k) const {
+			const vector<Path> paths = find(from, to, k);
+
+			if(paths.empty()) {
+				cout << from << " " << to << ": Not reachable" << endl;
+			}
+
+			for(size_t p = 0; p < paths.size(); p++) {
+				cout << "Path " << p + 1 << ": ";
+				for(size_t i = 0; i < paths[p].vertices_.size(); i++) {
+					cout << (i > 0 ? ", " : "") << paths[p].vertices_[i];
+				}
+				cout << ", Cost: " << fixed << setprecision(1) << paths[p].cost_
+					  << endl;
+			}
+		}
+
+private:
+
+	// PRIVATE STRUCT - CANDIDATE (path found by a spur search, ordered by cost)
+	struct Candidate {
+		Path path_;
+		int deviation_; // Index of the spur vertex the path deviates at.
+
+		bool operator<(const Candidate & rhs) const {
+			if(path_.cost_ != rhs.path_.cost_) {
+				return path_.cost_ < rhs.path_.cost_;
+			}
+			return path_.vertices_ < rhs.path_.vertices_;
+		}
+	};
+
+	// PRIVATE CLASS - SPURTHREADS (helper threads kept for every round of a
+	// find() call)
+	class SpurThreads {
+	public:
+
+			// Constructor - start the helper threads.
+			// @helpers		Number of helper threads (0 runs every round on the
+			//					calling thread alone).
+			// @work			Called as work(t) by thread t each round; the calling
+			//					thread is 0 and the helpers 1 to helpers.
+			SpurThreads(const int helpers, const function<void(int)> &work) :
+				work_(work), round_{0}, busy_{0}, stop_{false} {
+				for(int t = 1; t <= helpers; t++) {
+					helpers_.push_back(thread(&SpurThreads::helperLoop, this, t));
+				}
+			}
+
+			// Destructor - stop and join the helper threads.
+			~SpurThreads() {
+				{
+					lock_guard<mutex> lock(mutex_);
+					stop_ = true;
+				}
+				wake_.notify_all();
+				for(size_t t = 0; t < helpers_.size(); t++) {
+					helpers_[t].join();
+				}
+			}
+
+			// Run one round on the calling thread and every helper, and wait
+			// until all of them are done.
+			void run() {
+				{
+					lock_guard<mutex> lock(mutex_);
+					busy_ = static_cast<int>(helpers_.size());
+					round_++;
+				}
+				wake_.notify_all();
+
+				work_(0);
+
+				unique_lock<mutex> lock(mutex_);
+				done_.wait(lock, [this] { return busy_ == 0; });
+			}
+
+	private:
+
+		function<void(int)> work_;
+		vector<thread> helpers_;
+		mutex mutex_;
+		condition_variable wake_;
+		condition_variable done_;
+		long round_;
+		int busy_;		// Helpers still working on the current round.
+		bool stop_;
+
+		// Wait for each round, run it, and report back, until stopped.
+		void helperLoop(const int t) {
+			long seen = 0;
+			unique_lock<mutex> lock(mutex_);
+
+			while(true) {
+				wake_.wait(lock, [&] { return stop_ || round_ != seen; });
+				if(stop_) {
+					return;
+				}
+				seen = round_;
+
+				lock.unlock();
+				work_(t);
+				lock.lock();
+
+				if(--busy_ == 0) {
+					done_.notify_one();
+				}
+			}
+		}
+	};
+
+	const Graph &graph_;
+	int number_of_threads_;
+
+	// Search for the shortest path that follows a path up to one of its
+	// vertices (the spur) and then deviates from every accepted path sharing
+	// that root.
+	// @path			Path to deviate from.
+	// @spurIndex	Index in path of the spur vertex.
+	// @accepted	Paths confirmed so far.
+	// @to			Identity (integer) of the target vertex.
+	// @workspace	Search arrays and masks of the calling thread; masks are
+	//					left cleared.
+	// @return		The spur path, or a path with no vertices if none exists.
+	Path spurSearch(const Path &path, const int spurIndex,
+						 const vector<Path> &accepted, const int to,
+						 Workspace &workspace) const {
+		const vector<int> &root = path.vertices_;
+		const int spur = root[spurIndex] - 1;
+		vector<int> maskedEdges;
+
+		// Mask the root path (other than the spur) and the next edge of every
+		// accepted path that shares the root.
+		for(int i = 0; i < spurIndex; i++) {
+			workspace.banned_vertex_[root[i] - 1] = true;
+		}
+
+		for(size_t p = 0; p < accepted.size(); p++) {
+			const vector<int> &other = accepted[p].vertices_;
+			if(static_cast<int>(other.size()) > spurIndex + 1 &&
+				equal(root.begin(), root.begin() + spurIndex + 1, other.begin())) {
+				workspace.banned_edge_[other[spurIndex + 1] - 1] = true;
+				maskedEdges.push_back(other[spurIndex + 1] - 1);
+			}
+		}
+
+		const vector<bool> &bannedVertex = workspace.banned_vertex_;
+		const vector<bool> &bannedEdge = workspace.banned_edge_;
+
+		graph_.search(spur + 1, workspace.state_,
+			[&](const int v, const int w, const float) {
+				return !bannedVertex[w] && !(v == spur && bannedEdge[w]);
+			},
+			[&](const int v, const float) { return v != to - 1; });
+
+		// Clear only the masks that were set.
+		for(int i = 0; i < spurIndex; i++) {
+			workspace.banned_vertex_[root[i] - 1] = false;
+		}
+		for(size_t i = 0; i < maskedEdges.size(); i++) {
+			workspace.banned_edge_[maskedEdges[i]] = false;
+		}
+
+		Path spurPath;
+		if(workspace.state_.distance(to - 1) == INT_MAX) {
+			return spurPath;
+		}
+
+		for(int v = to - 1; v != spur; v = workspace.state_.previous(v)) {
+			spurPath.vertices_.push_back(v + 1);
+		}
+		spurPath.vertices_.insert(spurPath.vertices_.end(),
+										  root.rbegin() + (root.size() - spurIndex - 1),
+										  root.rend());
+		reverse(spurPath.vertices_.begin(), spurPath.vertices_.end());
+		spurPath.cost_ = pathCost(spurPath.vertices_);
+
+		return spurPath;
+	}
+
+	// @return		Cost of a path, summed from the origin as Dijkstra's
+	//					algorithm does.
+	float pathCost(const vector<int> &vertices) const {
+		float cost = 0.0;
+		for(size_t i = 1; i < vertices.size(); i++) {
+			cost += graph_.isConnected(vertices[i - 1], vertices[i]);
+		}
+		return cost;
+	}
+
+};
+
+#endif /* KShortestPaths_h */
@@ -0,0 +1,95 @@
+/*
+File Name: QueryReachability.cc
+Date Begun: 10/18/2026
+
+This file contains the routine for building a ReachabilityIndex of a graph and
+answering a batch of reachability queries (origin and target pairs) from a
+.txt file, in the same form as the adjacency queries of CreateGraphAndTest,
+followed by the size of the index and the average time taken per query.
+
+*/
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Graph.h"
+#include "GraphFiles.h"
+#include "ReachabilityIndex.h"
+using namespace std;
+
+// Function for answering reachability queries with an index.
+// @query_filename 	Filename of .txt file containing reachability queries
+//							(origin and target pairs).
+// @index				ReachabilityIndex to be queried.
+// Pre-Conditions:	index has been built and query_filename is a valid .txt
+//							filename.
+// Post-Conditions:	Results of all queries, and the average time taken to
+//							answer one, have been output.
+void queryReachability(const string query_filename,
+							  const ReachabilityIndex &index) {
+	// Open query file and read every query before timing them.
+	ifstream queryInput = openFile(query_filename);
+	
+	vector<pair<int, int>> queries;
+	int originVertex(0), targetVertex(0);
+	string line;
+	stringstream sLine;
+	
+	while(getline(queryInput, line)) {
+		sLine.clear();
+		sLine.str(line);
+		
+		if(sLine >> originVertex >> targetVertex) {
+			queries.push_back(make_pair(originVertex, targetVertex));
+		}
+	}
+	
+	queryInput.close();
+	
+	// Answer all queries
+	vector<bool> answers(queries.size());
+	const auto start = chrono::steady_clock::now();
+	
+	for(size_t i = 0; i < queries.size(); i++) {
+		answers[i] = index.reaches(queries[i].first, queries[i].second);
+	}
+	
+	const double elapsed = chrono::duration<double, micro>(
+		chrono::steady_clock::now() - start).count();
+	
+	// Output results
+	for(size_t i = 0; i < queries.size(); i++) {
+		cout << queries[i].first << " " << queries[i].second << ": "
+			  << (answers[i] ? "Reachable" : "Not reachable") << endl;
+	}
+	
+	cout << endl;
+	index.outputIndexInformation();
+	
+	if(!queries.empty()) {
+		cout << "Average Query Time: " << elapsed / queries.size()
+			  << " microseconds" << endl << endl;
+	}
+}
+
+int main(int argc, char **argv) {
+	if (argc != 3) {
+		cout << "Usage: " << argv[0] << " <graphtxtfilename> <querytxtfilename>"
+			  << endl << endl;
+		return 0;
+	}
+	
+	const string graph_filename(argv[1]);
+	const string query_filename(argv[2]);
+	
+	// Create Graph and index it
+	const ReachabilityIndex index(createGraph(graph_filename));
+	
+	// Query index
+	queryReachability(query_filename, index);
+
+	return 0;
+}
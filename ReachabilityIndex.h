@@ -0,0 +1,426 @@
+/*
+File Name: ReachabilityIndex.h
+Date Begun: 10/18/2026
+
+This header file contains the interface and implementation (for ease of
+compilation) of the ReachabilityIndex class, which answers whether one vertex
+of a Graph can reach another along directed edges, without searching the
+Graph for every query.
+
+The index is built in two steps:
+1) Condensation: the strongly connected components of the Graph are found
+	(Tarjan's algorithm, without recursion) and each is collapsed into one
+	vertex of a directed acyclic graph (DAG); vertices in the same component
+	always reach each other.
+2) Labeling (GRAIL): several randomized depth-first traversals of the DAG each
+	give every component an interval, [lowest post-order rank below it, its own
+	post-order rank], that contains the interval of every component it reaches.
+	Each component also gets its height in the DAG, and its range of pre-order
+	numbers in the first traversal's spanning tree.
+
+A query is first answered from the labels alone: a target whose interval is not
+contained in the origin's (in any traversal), or which is not lower in the DAG,
+is not reachable; a target below the origin in the spanning tree is. Only the
+remaining queries search the DAG, and that search is pruned by the same labels.
+
+PUBLIC OPERATIONS:
+* reaches(from, to)					Check if one vertex can reach another.
+* numberOfComponents()				Return the number of strongly connected
+											components.
+* outputIndexInformation()			Print the size of the index.
+
+*/
+
+#ifndef ReachabilityIndex_h
+#define ReachabilityIndex_h
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <limits.h>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "Graph.h"
+using namespace std;
+
+class ReachabilityIndex {
+public:
+
+		// Constructor - build the index of a Graph (which is not kept).
+		// @graph					Graph to index.
+		// @numberOfLabels		Number of randomized traversals to label the DAG
+		//								with; more prune more queries but take more space.
+		// @seed					Seed for the traversal orders.
+		explicit ReachabilityIndex(const Graph &graph, const int numberOfLabels = 3,
+											unsigned seed = 1) :
+			number_of_vertices_{graph.numberOfVertices()},
+			number_of_labels_{max(1, numberOfLabels)},
+			component_(graph.numberOfVertices(), -1), searches_{0} {
+			condense(graph);
+			label(seed);
+		}
+
+		// Check if there is a directed path from one vertex to another.
+		// @from					Identity (integer) of the origin vertex.
+		// @to					Identity (integer) of the target vertex.
+		// @return				True if to is reachable from from (every vertex reaches
+		//							itself); false otherwise.
+		// Pre-Condition:		from and to are valid vertex identities (integers).
+		//							This is checked in the function.
+		bool reaches(const int from, const int to) const {
+			// Check valid input
+			if(from < 1 || from > number_of_vertices_ || to < 1 ||
+				to > number_of_vertices_) {
+				cout << "Invalid vertex selections! Please provide selections "
+					  << "between 1 and " << number_of_vertices_ << endl << endl;
+				return false;
+			}
+
+			const int u = component_[from - 1];
+			const int v = component_[to - 1];
+
+			if(u == v) {
+				return true;
+			}
+			if(!mayReach(u, v)) {
+				return false;
+			}
+			if(isTreeDescendant(u, v)) {
+				return true;
+			}
+
+			return search(u, v);
+		}
+
+		// @return		Number of strongly connected components (vertices of the
+		//					condensed DAG).
+		int numberOfComponents() const {
+			return static_cast<int>(height_.size());
+		}
+
+		// @return		Number of queries so far that needed a search of the DAG.
+		long numberOfSearches() const {
+			return searches_;
+		}
+
+		// Utility for printing the size of the index: components, DAG edges and
+		// labels per component.
+		void outputIndexInformation() const {
+			cout << "Strongly Connected Components: " << numberOfComponents()
+				  << endl;
+			cout << "DAG Edges: " << targets_.size() << endl;
+			cout << "Labels Per Component: " << number_of_labels_ << endl;
+			cout << "Queries Searched: " << searches_ << endl << endl;
+		}
+
+private:
+
+	int number_of_vertices_;
+	int number_of_labels_;
+
+	// Component (DAG vertex) of every Graph vertex, and the DAG's edges in
+	// compressed form: the successors of component c are
+	// targets_[offsets_[c]] to targets_[offsets_[c + 1] - 1].
+	vector<int> component_;
+	vector<long> offsets_;
+	vector<int> targets_;
+
+	// Labels of each component: for traversal i, the interval
+	// [low_[c * labels + i], rank_[c * labels + i]]; its height (longest path
+	// to a sink); and its pre-order number and subtree end in the first
+	// traversal's spanning tree.
+	vector<int> low_;
+	vector<int> rank_;
+	vector<int> height_;
+	vector<int> preorder_;
+	vector<int> subtree_end_;
+
+	mutable atomic<long> searches_;
+
+
+	/*
+	*****************************************************************************
+	****************************PRIVATE FUNCTIONS********************************
+	*****************************************************************************
+	*/
+
+	// Find the strongly connected components of a Graph (Tarjan's algorithm,
+	// with an explicit stack) and build the condensed DAG between them.
+	// Components are numbered in the order completed, so every DAG edge leads
+	// from a higher to a lower number.
+	void condense(const Graph &graph) {
+		const int size = number_of_vertices_;
+		vector<int> index(size, -1), lowLink(size, 0);
+		vector<bool> onStack(size, false);
+		vector<int> stack;
+		vector<pair<int, size_t>> frames; // (vertex, next edge to follow)
+		int nextIndex = 0, components = 0;
+
+		for(int root = 0; root < size; root++) {
+			if(index[root] != -1) {
+				continue;
+			}
+
+			frames.push_back(make_pair(root, 0));
+			index[root] = lowLink[root] = nextIndex++;
+			stack.push_back(root);
+			onStack[root] = true;
+
+			while(!frames.empty()) {
+				const int v = frames.back().first;
+				size_t &next = frames.back().second;
+				const Graph::Vertex &opV = graph.graph_vertices_[v];
+
+				// Descend into the next unvisited successor, if any.
+				bool descended = false;
+				while(next < opV.adjacent_vertices_.size()) {
+					const int w = opV.adjacent_vertices_[next];
+					const bool live = opV.edge_weights_[next] >= 0.0;
+					next++;
+
+					if(!live) {
+						continue;
+					}
+					if(index[w] == -1) {
+						index[w] = lowLink[w] = nextIndex++;
+						stack.push_back(w);
+						onStack[w] = true;
+						frames.push_back(make_pair(w, 0));
+						descended = true;
+						break;
+					}
+					if(onStack[w]) {
+						lowLink[v] = min(lowLink[v], index[w]);
+					}
+				}
+
+				if(descended) {
+					continue;
+				}
+
+				// All successors done: close v's component if it is the root.
+				if(lowLink[v] == index[v]) {
+					int w;
+					do {
+						w = stack.back();
+						stack.pop_back();
+						onStack[w] = false;
+						component_[w] = components;
+					} while(w != v);
+					components++;
+				}
+
+				frames.pop_back();
+				if(!frames.empty()) {
+					const int parent = frames.back().first;
+					lowLink[parent] = min(lowLink[parent], lowLink[v]);
+				}
+			}
+		}
+
+		// DAG edges, bucketed by origin component and without duplicates.
+		offsets_.assign(components + 1, 0);
+		for(int v = 0; v < size; v++) {
+			const Graph::Vertex &opV = graph.graph_vertices_[v];
+			for(size_t i = 0; i < opV.adjacent_vertices_.size(); i++) {
+				if(opV.edge_weights_[i] >= 0.0 &&
+					component_[opV.adjacent_vertices_[i]] != component_[v]) {
+					offsets_[component_[v] + 1]++;
+				}
+			}
+		}
+		for(int c = 0; c < components; c++) {
+			offsets_[c + 1] += offsets_[c];
+		}
+
+		targets_.resize(offsets_.back());
+		vector<long> next(offsets_.begin(), offsets_.end() - 1);
+		for(int v = 0; v < size; v++) {
+			const Graph::Vertex &opV = graph.graph_vertices_[v];
+			for(size_t i = 0; i < opV.adjacent_vertices_.size(); i++) {
+				const int target = component_[opV.adjacent_vertices_[i]];
+				if(opV.edge_weights_[i] >= 0.0 && target != component_[v]) {
+					targets_[next[component_[v]]++] = target;
+				}
+			}
+		}
+
+		long kept = 0;
+		for(int c = 0; c < components; c++) {
+			const long begin = offsets_[c];
+			sort(targets_.begin() + begin, targets_.begin() + offsets_[c + 1]);
+			const long end = unique(targets_.begin() + begin,
+											targets_.begin() + offsets_[c + 1]) -
+				targets_.begin();
+
+			offsets_[c] = kept;
+			for(long i = begin; i < end; i++) {
+				targets_[kept++] = targets_[i];
+			}
+		}
+		offsets_[components] = kept;
+		targets_.resize(kept);
+	}
+
+	// Label the DAG: heights, then one interval per randomized depth-first
+	// traversal, recording the spanning tree of the first.
+	void label(unsigned seed) {
+		const int components = static_cast<int>(offsets_.size()) - 1;
+
+		// Successors always have lower numbers, so heights fill in one pass.
+		height_.assign(components, 0);
+		for(int c = 0; c < components; c++) {
+			for(long i = offsets_[c]; i < offsets_[c + 1]; i++) {
+				height_[c] = max(height_[c], height_[targets_[i]] + 1);
+			}
+		}
+
+		low_.assign(static_cast<long>(components) * number_of_labels_, 0);
+		rank_.assign(static_cast<long>(components) * number_of_labels_, 0);
+		preorder_.assign(components, 0);
+		subtree_end_.assign(components, 0);
+
+		vector<int> roots(components);
+		vector<int> order(targets_.begin(), targets_.end());
+		vector<bool> visited(components);
+		vector<pair<int, long>> frames; // (component, next edge to follow)
+
+		for(int label = 0; label < number_of_labels_; label++) {
+			// Randomize the order of roots and of every component's successors.
+			for(int c = 0; c < components; c++) {
+				roots[c] = c;
+			}
+			shuffle(roots, 0, components, seed);
+			for(int c = 0; c < components; c++) {
+				shuffle(order, offsets_[c], offsets_[c + 1], seed);
+			}
+
+			fill(visited.begin(), visited.end(), false);
+			int nextRank = 0, nextPreorder = 0;
+
+			for(int r = 0; r < components; r++) {
+				if(visited[roots[r]]) {
+					continue;
+				}
+
+				visited[roots[r]] = true;
+				frames.push_back(make_pair(roots[r], offsets_[roots[r]]));
+				if(label == 0) {
+					preorder_[roots[r]] = nextPreorder++;
+				}
+
+				while(!frames.empty()) {
+					const int c = frames.back().first;
+					long &next = frames.back().second;
+					const long labelC = static_cast<long>(c) * number_of_labels_ +
+						label;
+
+					if(next == offsets_[c]) {
+						low_[labelC] = INT_MAX;
+					}
+
+					// Descend into the next unvisited successor, if any; every
+					// successor lowers c's interval.
+					bool descended = false;
+					while(next < offsets_[c + 1]) {
+						const int w = order[next++];
+						if(!visited[w]) {
+							visited[w] = true;
+							frames.push_back(make_pair(w, offsets_[w]));
+							if(label == 0) {
+								preorder_[w] = nextPreorder++;
+							}
+							descended = true;
+							break;
+						}
+						low_[labelC] = min(low_[labelC],
+							low_[static_cast<long>(w) * number_of_labels_ + label]);
+					}
+
+					if(descended) {
+						continue;
+					}
+
+					rank_[labelC] = nextRank++;
+					low_[labelC] = min(low_[labelC], rank_[labelC]);
+					if(label == 0) {
+						subtree_end_[c] = nextPreorder;
+					}
+
+					frames.pop_back();
+					if(!frames.empty()) {
+						const long labelParent = static_cast<long>(
+							frames.back().first) * number_of_labels_ + label;
+						low_[labelParent] = min(low_[labelParent], low_[labelC]);
+					}
+				}
+			}
+		}
+	}
+
+	// Randomly shuffle elements [begin, end) of a vector.
+	template <typename T>
+	static void shuffle(vector<T> &values, const long begin, const long end,
+							  unsigned &seed) {
+		for(long i = end - 1; i > begin; i--) {
+			swap(values[i], values[begin + rand_r(&seed) % (i - begin + 1)]);
+		}
+	}
+
+	// @return		False if the labels show component u cannot reach v; true
+	//					if it may.
+	bool mayReach(const int u, const int v) const {
+		if(height_[u] <= height_[v]) {
+			return false;
+		}
+
+		const long labelU = static_cast<long>(u) * number_of_labels_;
+		const long labelV = static_cast<long>(v) * number_of_labels_;
+		for(int i = 0; i < number_of_labels_; i++) {
+			if(low_[labelV + i] < low_[labelU + i] ||
+				rank_[labelV + i] > rank_[labelU + i]) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// @return		True if component v lies below u in the first traversal's
+	//					spanning tree (so u certainly reaches v).
+	bool isTreeDescendant(const int u, const int v) const {
+		return preorder_[u] <= preorder_[v] && preorder_[v] < subtree_end_[u];
+	}
+
+	// Search the DAG from component u for v, following only successors that
+	// the labels show may still reach v.
+	bool search(const int u, const int v) const {
+		searches_++;
+
+		unordered_set<int> visited;
+		vector<int> stack(1, u);
+		visited.insert(u);
+
+		while(!stack.empty()) {
+			const int c = stack.back();
+			stack.pop_back();
+
+			for(long i = offsets_[c]; i < offsets_[c + 1]; i++) {
+				const int w = targets_[i];
+				if(w == v || isTreeDescendant(w, v)) {
+					return true;
+				}
+				if(mayReach(w, v) && visited.insert(w).second) {
+					stack.push_back(w);
+				}
+			}
+		}
+
+		return false;
+	}
+
+};
+
+#endif /* ReachabilityIndex_h */
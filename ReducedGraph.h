@@ -0,0 +1,609 @@
+/*
+File Name: ReducedGraph.h
+Date Begun: 10/18/2026
+
+This header file contains the interface and implementation (for ease of
+compilation) of the ReducedGraph class, which preprocesses a Graph into a much
+smaller core graph for shortest-path queries, while answering them in terms of
+the original vertices.
+
+Two reductions are made, treating edges in either direction as connecting two
+vertices:
+1) Pruning: vertices connected to only one other vertex are removed,
+	repeatedly, so dangling trees are peeled back to the vertex they hang from.
+	No path between two other vertices can pass through a pruned vertex.
+2) Contraction: the remaining vertices connected to exactly two others form
+	chains between core vertices; each chain is replaced by a shortcut edge
+	in either direction in which all of its edges exist (weighted by the
+	chain's total), unless a cheaper edge already joins its ends.
+
+Dijkstra's algorithm then runs on the core graph alone. The parent of every
+pruned vertex and the vertices and edge weights of every chain are kept, so
+that a query can enter the core from a pruned or contracted origin, and so
+that distances and paths are expanded back to every original vertex in a
+single linear sweep over the chains and trees.
+
+PUBLIC OPERATIONS:
+* dijkstra(from)								Run Dijkstra's algorithm and output all
+													path information, as Graph::dijkstra.
+* shortestPaths(from, distance, previous)
+													Shortest paths to every original vertex,
+													as Graph::shortestPaths.
+* numberOfCoreVertices()					Return the number of core vertices.
+* outputReductionInformation()			Print how far the Graph was reduced.
+
+*/
+
+#ifndef ReducedGraph_h
+#define ReducedGraph_h
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <limits.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Graph.h"
+#include "GraphBuilder.h"
+using namespace std;
+
+class ReducedGraph {
+public:
+
+		// Constructor - reduce a Graph (which is not modified or kept).
+		// @graph		Graph to reduce.
+		explicit ReducedGraph(const Graph &graph) :
+			number_of_vertices_{graph.numberOfVertices()},
+			role_(graph.numberOfVertices(), CORE),
+			core_index_(graph.numberOfVertices(), -1),
+			number_of_shortcuts_{0},
+			parent_(graph.numberOfVertices(), -1),
+			up_weight_(graph.numberOfVertices(), -1.0),
+			down_weight_(graph.numberOfVertices(), -1.0) {
+			vector<vector<Link>> links = linksOf(graph);
+
+			prune(links);
+			contract(links);
+			buildCore(links);
+		}
+
+		// Run Dijkstra's algorithm from a vertex and output the path to and
+		// distance of every vertex, in the same format as Graph::dijkstra.
+		// @from			Identity (integer) of an origin vertex.
+		// Pre-Condition:	from is a valid vertex identity. This is checked in
+		//						the function.
+		void dijkstra(const int from) const {
+			if(from < 1 || from > number_of_vertices_) {
+				cout << "Invalid vertex selection! Please provide a selection "
+					  << "between 1 and " << number_of_vertices_ << endl << endl;
+				return;
+			}
+
+			vector<float> distance;
+			vector<int> previous;
+			shortestPaths(from, distance, previous);
+
+			vector<int> path;
+			for(int i = 0; i < number_of_vertices_; i++) {
+				path.clear();
+				for(int v = i; v != -1; v = previous[v]) {
+					path.push_back(v + 1);
+				}
+
+				cout << i + 1 << ": ";
+				for(size_t j = path.size(); j > 0; j--) {
+					cout << path[j - 1] << (j > 1 ? ", " : "");
+				}
+				cout << ", Cost: " << fixed << setprecision(1) << distance[i];
+				cout << endl;
+			}
+		}
+
+		// Computes shortest paths from an origin vertex to every vertex of the
+		// original Graph, searching only the core graph.
+		// @from					Identity (integer) of an origin vertex.
+		// @distance			Filled with the distance of each vertex (indexed by
+		//							identity - 1) from the origin; INT_MAX if unreachable.
+		// @previous			Filled with the index (identity - 1) of the prior
+		//							vertex on the path to each vertex; -1 if none.
+		// Pre-Condition:		from is a valid vertex identity. This is checked in
+		//							the function.
+		void shortestPaths(const int from, vector<float> &distance,
+								 vector<int> &previous) const {
+			distance.assign(number_of_vertices_, INT_MAX);
+			previous.assign(number_of_vertices_, -1);
+
+			// Check valid input
+			if(from < 1 || from > number_of_vertices_) {
+				cout << "Invalid vertex selections! Please provide selections "
+					  << "between 1 and " << number_of_vertices_ << endl << endl;
+				return;
+			}
+
+			// Climb from a pruned origin towards the vertex its tree hangs from.
+			int entry = from - 1;
+			distance[entry] = 0.0;
+
+			while(role_[entry] == PRUNED && up_weight_[entry] >= 0.0) {
+				relax(entry, parent_[entry], up_weight_[entry], distance, previous);
+				entry = parent_[entry];
+			}
+
+			// Enter the core, along the chain if the entry vertex lies on one.
+			vector<int> seeds;
+			if(role_[entry] == CORE) {
+				seeds.push_back(entry);
+			}
+			else if(role_[entry] == CHAIN) {
+				const Chain &chain = chains_[chain_of_.at(entry)];
+				const int position = position_.at(entry);
+				const int last = static_cast<int>(chain.vertices_.size()) - 1;
+
+				int j = position;
+				while(j < last && chain.forward_[j] >= 0.0) {
+					relax(chain.vertices_[j], chain.vertices_[j + 1],
+							chain.forward_[j], distance, previous);
+					j++;
+				}
+				if(j == last) {
+					seeds.push_back(chain.vertices_[last]);
+				}
+
+				j = position;
+				while(j > 0 && chain.backward_[j - 1] >= 0.0) {
+					relax(chain.vertices_[j], chain.vertices_[j - 1],
+							chain.backward_[j - 1], distance, previous);
+					j--;
+				}
+				if(j == 0) {
+					seeds.push_back(chain.vertices_[0]);
+				}
+			}
+
+			searchCore(seeds, distance, previous);
+
+			// Expand into every chain from both of its ends...
+			for(size_t c = 0; c < chains_.size(); c++) {
+				const Chain &chain = chains_[c];
+				const int last = static_cast<int>(chain.vertices_.size()) - 1;
+
+				for(int j = 0; j + 1 < last; j++) {
+					if(chain.forward_[j] >= 0.0) {
+						relax(chain.vertices_[j], chain.vertices_[j + 1],
+								chain.forward_[j], distance, previous);
+					}
+				}
+				for(int j = last; j > 1; j--) {
+					if(chain.backward_[j - 1] >= 0.0) {
+						relax(chain.vertices_[j], chain.vertices_[j - 1],
+								chain.backward_[j - 1], distance, previous);
+					}
+				}
+			}
+
+			// ...then down every tree, parents first.
+			for(size_t i = 0; i < tree_order_.size(); i++) {
+				const int v = tree_order_[i];
+				if(down_weight_[v] >= 0.0) {
+					relax(parent_[v], v, down_weight_[v], distance, previous);
+				}
+			}
+		}
+
+		// @return		Number of vertices in the core graph.
+		int numberOfCoreVertices() const {
+			return static_cast<int>(original_index_.size());
+		}
+
+		// Utility for printing how far the Graph was reduced: vertices pruned
+		// and contracted, and the size of the remaining core graph.
+		void outputReductionInformation() const {
+			long coreEdges = 0;
+			for(int c = 0; c < numberOfCoreVertices(); c++) {
+				const Graph::Vertex &opV = core_.graph_vertices_[c];
+				coreEdges += static_cast<long>(opV.adjacent_vertices_.size()) -
+					opV.dead_edges_;
+			}
+
+			cout << "Vertices Pruned: " << tree_order_.size() << endl;
+			cout << "Vertices Contracted: " << chain_of_.size() << " (in "
+				  << chains_.size() << " chains)" << endl;
+			cout << "Core Vertices: " << numberOfCoreVertices() << endl;
+			cout << "Core Edges: " << coreEdges << " (" << number_of_shortcuts_
+				  << " shortcuts)" << endl << endl;
+		}
+
+private:
+
+	// Role of an original vertex in the reduction.
+	enum Role { CORE, PRUNED, CHAIN };
+
+	// PRIVATE STRUCT - LINK (a neighbor, with the edge weight each way; -1.0
+	// where there is no edge)
+	struct Link {
+		int vertex_;
+		float out_;
+		float in_;
+	};
+
+	// PRIVATE STRUCT - CHAIN (contracted vertices between two core vertices)
+	struct Chain {
+		// Original indices, from one core end to the other (which may be the
+		// same vertex); every other vertex is contracted.
+		vector<int> vertices_;
+		// Weight of the edge from vertices_[j] to vertices_[j + 1], and back;
+		// -1.0 where there is no edge.
+		vector<float> forward_;
+		vector<float> backward_;
+	};
+
+	// PRIVATE STRUCT - SEEDS (edges from the spare core vertex into the core,
+	// weighted by each seed's distance from the origin)
+	struct Seeds {
+		const vector<pair<int, float>> &seeds_;
+		const int spare_;
+
+		Seeds(const vector<pair<int, float>> &seeds, const int spare) :
+			seeds_(seeds), spare_{spare} { }
+
+		template <typename Relax>
+		void operator()(const int v, Relax &relax) const {
+			if(v == spare_) {
+				for(size_t i = 0; i < seeds_.size(); i++) {
+					relax(seeds_[i].first, seeds_[i].second);
+				}
+			}
+		}
+	};
+
+	int number_of_vertices_;
+	vector<Role> role_;
+
+	// Core graph, on core indices, plus one spare vertex from which queries
+	// start (see searchCore). Shortcut edges map to the chain they replace and
+	// whether they run along it (forward) or against it.
+	Graph core_;
+	vector<int> core_index_;
+	vector<int> original_index_;
+	unordered_map<long, pair<int, bool>> shortcuts_;
+	long number_of_shortcuts_;
+
+	// Contracted vertices: their chain, and their position along it.
+	vector<Chain> chains_;
+	unordered_map<int, int> chain_of_;
+	unordered_map<int, int> position_;
+
+	// Pruned vertices: the neighbor towards the vertex their tree hangs from,
+	// the edge weights to and from it, and the order to visit them in so that
+	// parents come first.
+	vector<int> parent_;
+	vector<float> up_weight_;
+	vector<float> down_weight_;
+	vector<int> tree_order_;
+
+
+	/*
+	*****************************************************************************
+	****************************PRIVATE FUNCTIONS********************************
+	*****************************************************************************
+	*/
+
+	// Relax an edge of the original Graph during a query.
+	static void relax(const int v, const int w, const float weight,
+							vector<float> &distance, vector<int> &previous) {
+		if(distance[v] != INT_MAX && distance[v] + weight < distance[w]) {
+			distance[w] = distance[v] + weight;
+			previous[w] = v;
+		}
+	}
+
+	// @return		The neighbors of every vertex, sorted, with the weight of
+	//					the (live) edges each way.
+	static vector<vector<Link>> linksOf(const Graph &graph) {
+		const int size = graph.numberOfVertices();
+		vector<vector<Link>> links(size);
+
+		for(int v = 0; v < size; v++) {
+			const Graph::Vertex &opV = graph.graph_vertices_[v];
+			for(size_t i = 0; i < opV.adjacent_vertices_.size(); i++) {
+				if(opV.edge_weights_[i] >= 0.0) {
+					const int w = opV.adjacent_vertices_[i];
+					Link out = {w, opV.edge_weights_[i], -1.0};
+					Link in = {v, -1.0, opV.edge_weights_[i]};
+					links[v].push_back(out);
+					links[w].push_back(in);
+				}
+			}
+		}
+
+		// Merge the two directions of each neighbor into one Link.
+		for(int v = 0; v < size; v++) {
+			vector<Link> &vLinks = links[v];
+			sort(vLinks.begin(), vLinks.end(),
+				  [](const Link &a, const Link &b) { return a.vertex_ < b.vertex_; });
+
+			size_t kept = 0;
+			for(size_t i = 0; i < vLinks.size(); i++) {
+				if(kept > 0 && vLinks[kept - 1].vertex_ == vLinks[i].vertex_) {
+					vLinks[kept - 1].out_ = max(vLinks[kept - 1].out_, vLinks[i].out_);
+					vLinks[kept - 1].in_ = max(vLinks[kept - 1].in_, vLinks[i].in_);
+				}
+				else {
+					vLinks[kept++] = vLinks[i];
+				}
+			}
+			vLinks.resize(kept);
+		}
+
+		return links;
+	}
+
+	// Prune vertices with a single neighbor, repeatedly. A vertex left with
+	// no neighbors stays in the core as the root of its tree.
+	void prune(const vector<vector<Link>> &links) {
+		vector<int> degree(number_of_vertices_);
+		vector<int> queue;
+
+		for(int v = 0; v < number_of_vertices_; v++) {
+			degree[v] = static_cast<int>(links[v].size());
+			if(degree[v] == 1) {
+				queue.push_back(v);
+			}
+		}
+
+		for(size_t i = 0; i < queue.size(); i++) {
+			const int v = queue[i];
+			if(degree[v] != 1) {
+				continue;
+			}
+
+			for(size_t j = 0; j < links[v].size(); j++) {
+				const Link &link = links[v][j];
+				if(role_[link.vertex_] != PRUNED) {
+					role_[v] = PRUNED;
+					parent_[v] = link.vertex_;
+					up_weight_[v] = link.out_;
+					down_weight_[v] = link.in_;
+					tree_order_.push_back(v);
+
+					degree[v] = 0;
+					if(--degree[link.vertex_] == 1) {
+						queue.push_back(link.vertex_);
+					}
+					break;
+				}
+			}
+		}
+
+		reverse(tree_order_.begin(), tree_order_.end());
+	}
+
+	// Contract the remaining vertices with exactly two remaining neighbors
+	// into chains. A cycle made up only of such vertices keeps one of them in
+	// the core as both ends of its chain.
+	void contract(const vector<vector<Link>> &links) {
+		// The two remaining links of each candidate vertex.
+		unordered_map<int, pair<Link, Link>> remaining;
+
+		for(int v = 0; v < number_of_vertices_; v++) {
+			if(role_[v] == PRUNED) {
+				continue;
+			}
+
+			vector<Link> kept;
+			for(size_t j = 0; j < links[v].size() && kept.size() <= 2; j++) {
+				if(role_[links[v][j].vertex_] != PRUNED) {
+					kept.push_back(links[v][j]);
+				}
+			}
+			if(kept.size() == 2) {
+				remaining[v] = make_pair(kept[0], kept[1]);
+			}
+		}
+
+		for(int v = 0; v < number_of_vertices_; v++) {
+			if(remaining.count(v) == 0 || chain_of_.count(v) != 0) {
+				continue;
+			}
+
+			// Walk out from v both ways until reaching a core vertex, or v.
+			vector<int> ahead = walk(v, remaining[v].first.vertex_, remaining);
+			vector<int> behind;
+			if(ahead.back() != v) {
+				behind = walk(v, remaining[v].second.vertex_, remaining);
+			}
+
+			Chain chain;
+			chain.vertices_.assign(behind.rbegin(), behind.rend());
+			chain.vertices_.push_back(v);
+			chain.vertices_.insert(chain.vertices_.end(), ahead.begin(),
+										  ahead.end());
+
+			const int last = static_cast<int>(chain.vertices_.size()) - 1;
+			const int c = static_cast<int>(chains_.size());
+			chain.forward_.assign(last, -1.0);
+			chain.backward_.assign(last, -1.0);
+
+			// Read the edge weights off the interior vertices' links.
+			for(int j = 1; j < last; j++) {
+				const int u = chain.vertices_[j];
+				const pair<Link, Link> &pairLinks = remaining[u];
+
+				for(int side = 0; side < 2; side++) {
+					const Link &link = side == 0 ? pairLinks.first : pairLinks.second;
+					if(link.vertex_ == chain.vertices_[j + 1]) {
+						chain.forward_[j] = link.out_;
+						chain.backward_[j] = link.in_;
+					}
+					else {
+						chain.forward_[j - 1] = link.in_;
+						chain.backward_[j - 1] = link.out_;
+					}
+				}
+
+				role_[u] = CHAIN;
+				chain_of_[u] = c;
+				position_[u] = j;
+			}
+
+			chains_.push_back(chain);
+
+			// A cycle's remaining vertex is its chain's two ends.
+			if(ahead.back() == v) {
+				remaining.erase(v);
+			}
+		}
+	}
+
+	// Walk along candidate vertices from one to a neighbor.
+	// @return		The vertices after from, ending at the first non-candidate
+	//					vertex, or at from if the walk comes back round to it.
+	static vector<int> walk(const int from, int next,
+									unordered_map<int, pair<Link, Link>> &remaining) {
+		vector<int> path(1, next);
+		int previous = from;
+
+		while(next != from && remaining.count(next) != 0) {
+			const pair<Link, Link> &pairLinks = remaining[next];
+			const int after = pairLinks.first.vertex_ != previous ?
+				pairLinks.first.vertex_ : pairLinks.second.vertex_;
+
+			previous = next;
+			next = after;
+			path.push_back(next);
+		}
+
+		return path;
+	}
+
+	// Build the core graph: every edge between core vertices, plus a shortcut
+	// for each chain in each direction it can be travelled.
+	void buildCore(const vector<vector<Link>> &links) {
+		for(int v = 0; v < number_of_vertices_; v++) {
+			if(role_[v] == CORE) {
+				core_index_[v] = static_cast<int>(original_index_.size());
+				original_index_.push_back(v);
+			}
+		}
+
+		const int coreSize = numberOfCoreVertices();
+		GraphBuilder builder(coreSize + 1);
+
+		for(int c = 0; c < coreSize; c++) {
+			const vector<Link> &cLinks = links[original_index_[c]];
+			for(size_t j = 0; j < cLinks.size(); j++) {
+				if(cLinks[j].out_ >= 0.0 && role_[cLinks[j].vertex_] == CORE) {
+					builder.addEdge(c + 1, core_index_[cLinks[j].vertex_] + 1,
+										 cLinks[j].out_);
+				}
+			}
+		}
+		core_ = builder.build();
+
+		for(size_t c = 0; c < chains_.size(); c++) {
+			const Chain &chain = chains_[c];
+			const int last = static_cast<int>(chain.vertices_.size()) - 1;
+
+			if(chain.vertices_[0] == chain.vertices_[last]) {
+				continue;
+			}
+
+			float forward = 0.0, backward = 0.0;
+			for(int j = 0; j < last && forward != -1.0; j++) {
+				forward = chain.forward_[j] < 0.0 ? -1.0 : forward + chain.forward_[j];
+			}
+			for(int j = last; j > 0 && backward != -1.0; j--) {
+				backward = chain.backward_[j - 1] < 0.0 ? -1.0 :
+					backward + chain.backward_[j - 1];
+			}
+
+			addShortcut(chain.vertices_[0], chain.vertices_[last], forward,
+							static_cast<int>(c), true);
+			addShortcut(chain.vertices_[last], chain.vertices_[0], backward,
+							static_cast<int>(c), false);
+		}
+	}
+
+	// Add (or lower the weight of a core edge to) a shortcut for a chain.
+	void addShortcut(const int from, const int to, const float weight,
+						  const int chain, const bool forward) {
+		if(weight < 0.0) {
+			return;
+		}
+
+		const int coreFrom = core_index_[from] + 1;
+		const int coreTo = core_index_[to] + 1;
+		const float existing = core_.isConnected(coreFrom, coreTo);
+
+		if(existing == -1.0) {
+			core_.addEdge(coreFrom, coreTo, weight);
+		}
+		else if(weight < existing) {
+			core_.updateWeight(coreFrom, coreTo, weight);
+		}
+		else {
+			return;
+		}
+
+		if(shortcuts_.count(key(coreFrom - 1, coreTo - 1)) == 0) {
+			number_of_shortcuts_++;
+		}
+		shortcuts_[key(coreFrom - 1, coreTo - 1)] = make_pair(chain, forward);
+	}
+
+	// @return		Key of a core edge in shortcuts_.
+	long key(const int from, const int to) const {
+		return static_cast<long>(from) * (numberOfCoreVertices() + 1) + to;
+	}
+
+	// Run Dijkstra's algorithm on the core graph from the seed vertices (at
+	// their current distances), and copy the distance of, and prior original
+	// vertex on the path to, each core vertex reached. The search starts at
+	// the spare core vertex, with an edge to each seed weighted by its
+	// distance, so that seeds need not start at distance 0.
+	void searchCore(const vector<int> &seeds, vector<float> &distance,
+						 vector<int> &previous) const {
+		const int spare = numberOfCoreVertices();
+		vector<pair<int, float>> coreSeeds;
+
+		for(size_t i = 0; i < seeds.size(); i++) {
+			coreSeeds.push_back(make_pair(core_index_[seeds[i]],
+													distance[seeds[i]]));
+		}
+
+		Graph::SearchState state(spare + 1);
+		core_.search(vector<int>(1, spare + 1), state,
+			[](const int, const int, const float) { return true; },
+			[](const int, const float) { return true; },
+			Seeds(coreSeeds, spare));
+
+		for(int c = 0; c < spare; c++) {
+			const int p = state.previous(c);
+			if(p == -1) {
+				continue;
+			}
+
+			const int v = original_index_[c];
+			distance[v] = state.distance(c);
+
+			// A seed keeps the prior vertex it was reached by from the origin.
+			if(p == spare) {
+				continue;
+			}
+
+			auto shortcut = shortcuts_.find(key(p, c));
+			if(shortcut == shortcuts_.end()) {
+				previous[v] = original_index_[p];
+			}
+			else {
+				const Chain &chain = chains_[shortcut->second.first];
+				previous[v] = shortcut->second.second ?
+					chain.vertices_[chain.vertices_.size() - 2] : chain.vertices_[1];
+			}
+		}
+	}
+
+};
+
+#endif /* ReducedGraph_h */
@@ -0,0 +1,212 @@
+/*
+File Name: TestConcurrentGraph.cc
+Date Begun: 10/18/2026
+
+This file contains the routine for testing concurrent use of a
+ConcurrentGraph: reader threads continuously run shortest-path and adjacency
+queries on pinned snapshots while the main thread adds random edges in
+batches, and removes or reweights some of them. The writer logs every change
+it makes, before making it, in order. Each reader keeps a plain Graph of its
+own which it brings up to each pinned snapshot by replaying the logged changes
+the snapshot includes (see Snapshot::changes), and checks the snapshot's
+adjacency and shortest-path answers against it; versions must only move
+forward. The final snapshot, and the base it is merged into, are checked
+against the writer's own Graph. The number of queries answered during
+ingestion and the number of versions and background merges are then output.
+
+*/
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ConcurrentGraph.h"
+#include "Graph.h"
+#include "GraphFiles.h"
+using namespace std;
+
+// Apply a logged change to a Graph.
+// @graph		Graph to change.
+// @change		Edge added or reweighted, or removed if its weight is negative.
+void applyChange(Graph &graph, const ConcurrentGraph::Edge &change) {
+	if(change.weight_ < 0.0) {
+		graph.removeEdge(change.from_, change.to_);
+	}
+	else if(!graph.updateWeight(change.from_, change.to_, change.weight_)) {
+		graph.addEdge(change.from_, change.to_, change.weight_);
+	}
+}
+
+int main(int argc, char**argv) {
+	if(argc != 4) {
+		cout << "Usage: " << argv[0] << " <graphtxtfilename> <#ofReaders>"
+			  << " <#ofEdgesToAdd>" << endl << endl;
+		return 0;
+	}
+	
+	const string graph_filename(argv[1]);
+	const int numberOfReaders(stoi(argv[2], nullptr));
+	const int numberOfEdges(stoi(argv[3], nullptr));
+	
+	const Graph base = createGraph(graph_filename);
+	ConcurrentGraph graph((Graph(base)));
+	const int size = graph.pin()->numberOfVertices();
+	
+	if(size < 2) {
+		cout << "Graph needs at least 2 vertices." << endl;
+		return 0;
+	}
+	
+	// Every change made by the writer, in order; logged before it is made.
+	mutex logMutex;
+	vector<ConcurrentGraph::Edge> log;
+	
+	atomic<bool> ingesting(true);
+	atomic<long> queries(0), failures(0);
+	vector<thread> readers;
+	
+	// Readers: query pinned snapshots until ingestion ends, checking each
+	// against a Graph holding the same changes.
+	for(int r = 0; r < numberOfReaders; r++) {
+		readers.push_back(thread([&, r] {
+			Graph reference(base);
+			size_t applied = 0;
+			Graph::SearchState state(size);
+			vector<float> distance;
+			vector<int> previous;
+			unsigned seed = r + 1;
+			long lastVersion = -1;
+			
+			while(ingesting) {
+				shared_ptr<const ConcurrentGraph::Snapshot> snapshot = graph.pin();
+				const int from = (rand_r(&seed) % size) + 1;
+				const int to = (rand_r(&seed) % size) + 1;
+				
+				if(snapshot->version() < lastVersion) {
+					failures++;
+				}
+				lastVersion = snapshot->version();
+				
+				// Bring the reference up to the changes the snapshot holds.
+				vector<ConcurrentGraph::Edge> changes;
+				{
+					lock_guard<mutex> lock(logMutex);
+					changes.assign(log.begin() + applied,
+										log.begin() + snapshot->changes());
+				}
+				for(size_t i = 0; i < changes.size(); i++) {
+					applyChange(reference, changes[i]);
+				}
+				applied += changes.size();
+				
+				if(snapshot->isConnected(from, to) !=
+					reference.isConnected(from, to)) {
+					failures++;
+				}
+				
+				// Distances may differ by rounding when equal-cost paths differ.
+				snapshot->search(from, state, [&](const int v, const float) {
+					return v != to - 1;
+				});
+				reference.shortestPaths(from, distance, previous, to);
+				const float expected = distance[to - 1];
+				const float found = state.distance(to - 1);
+				if((expected == INT_MAX) != (found == INT_MAX) ||
+					fabs(expected - found) > 1e-3 * max(1.0f, expected)) {
+					failures++;
+				}
+				
+				queries++;
+			}
+		}));
+	}
+	
+	// Writer: add random edges in batches of 64; after each batch, remove one
+	// earlier edge and reweight another. Changes that will take effect are
+	// applied to its own Graph and logged first.
+	Graph truth(base);
+	srand(time(0));
+	vector<ConcurrentGraph::Edge> batch;
+	vector<ConcurrentGraph::Edge> added;
+	set<pair<int, int>> touched;
+	
+	auto record = [&](const ConcurrentGraph::Edge &change) {
+		applyChange(truth, change);
+		lock_guard<mutex> lock(logMutex);
+		log.push_back(change);
+	};
+	
+	for(int i = 0; i < numberOfEdges; i++) {
+		ConcurrentGraph::Edge e = {(rand() % size) + 1, (rand() % size) + 1,
+											static_cast<float>(rand() % 100) / 10};
+		if(e.from_ == e.to_) {
+			continue;
+		}
+		
+		if(truth.isConnected(e.from_, e.to_) == -1.0) {
+			record(e);
+		}
+		batch.push_back(e);
+		added.push_back(e);
+		touched.insert(make_pair(e.from_, e.to_));
+		
+		if(batch.size() == 64) {
+			graph.addEdges(batch);
+			batch.clear();
+			
+			ConcurrentGraph::Edge removed = added[rand() % added.size()];
+			removed.weight_ = -1.0;
+			if(truth.isConnected(removed.from_, removed.to_) != -1.0) {
+				record(removed);
+			}
+			graph.removeEdge(removed.from_, removed.to_);
+			
+			ConcurrentGraph::Edge updated = added[rand() % added.size()];
+			updated.weight_ = 0.5;
+			if(truth.isConnected(updated.from_, updated.to_) != -1.0) {
+				record(updated);
+			}
+			graph.updateWeight(updated.from_, updated.to_, 0.5);
+		}
+	}
+	graph.addEdges(batch);
+	
+	ingesting = false;
+	for(size_t r = 0; r < readers.size(); r++) {
+		readers[r].join();
+	}
+	
+	// Every change must be visible in the latest snapshot, and still be once
+	// the delta has been merged into the base.
+	shared_ptr<const ConcurrentGraph::Snapshot> snapshot = graph.pin();
+	graph.merge();
+	shared_ptr<const ConcurrentGraph::Snapshot> merged = graph.pin();
+	
+	if(snapshot->changes() != static_cast<long>(log.size())) {
+		failures++;
+	}
+	
+	for(auto it = touched.begin(); it != touched.end(); it++) {
+		const int from = it->first;
+		const int to = it->second;
+		
+		if(snapshot->isConnected(from, to) != truth.isConnected(from, to) ||
+			merged->isConnected(from, to) != truth.isConnected(from, to)) {
+			failures++;
+		}
+	}
+	
+	cout << "Queries During Ingestion: " << queries << endl;
+	cout << "Versions Published: " << snapshot->version() << endl;
+	cout << "Background Merges: " << graph.numberOfMerges() << endl;
+	cout << "Unmerged Delta Edges: " << snapshot->deltaSize() << endl;
+	cout << "Consistency Failures: " << failures << endl << endl;
+	
+	return 0;
+}
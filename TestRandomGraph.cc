@@ -5,19 +5,96 @@ Date Begun: 4/22/2019
 
 This file contains the routine for creating a "random" graph of user specified
 number of vertices, where edges are edges are added until all vertices are
-connected, and outputing characteristics about the graph. These outputs should
-indicate that a graph does not need to be dense to achieve full connectivity.
+connected, and outputing characteristics about the graph (see also
+GraphStatistics.h). These outputs should indicate that a graph does not need
+to be dense to achieve full connectivity.
+
+The same edges, with random weights, are then built into a packed Graph by a
+GraphBuilder, and the statistics GraphStatistics computes for it are checked
+against ones counted edge by edge: as built, with some edges removed (left as
+tombstones) and after compact(). Each check prints Passed or FAILED.
 
 */
 
+#include <cmath>
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
 #include <string>
+#include <vector>
 #include "Graph.h"
+#include "GraphBuilder.h"
+#include "GraphStatistics.h"
 #include "disjoint_sets.h"
 using namespace std;
 
+// An edge of the random graph, as given to the GraphBuilder.
+struct TestEdge {
+	int from_;
+	int to_;
+	float weight_;
+	bool removed_;
+};
+
+// Count one vertex of a degree in a histogram, growing it as needed.
+void bin(vector<long> &histogram, const int degree) {
+	if(degree >= static_cast<int>(histogram.size())) {
+		histogram.resize(degree + 1, 0);
+	}
+	histogram[degree]++;
+}
+
+// Compare the statistics GraphStatistics computes for a Graph with ones
+// counted one edge at a time, and print the result.
+// @name			Name of the check.
+// @graph		Graph holding exactly the edges not marked removed.
+// @edges		Edges of the Graph.
+void checkStatistics(const string &name, const Graph &graph,
+							const vector<TestEdge> &edges) {
+	const int size = graph.numberOfVertices();
+	vector<int> outDegrees(size, 0), inDegrees(size, 0);
+	long numberOfEdges = 0;
+	float smallest = 0.0, largest = 0.0;
+	double sum = 0.0;
+
+	for(size_t i = 0; i < edges.size(); i++) {
+		if(edges[i].removed_) {
+			continue;
+		}
+		outDegrees[edges[i].from_ - 1]++;
+		inDegrees[edges[i].to_ - 1]++;
+		smallest = numberOfEdges > 0 ? min(smallest, edges[i].weight_) :
+			edges[i].weight_;
+		largest = numberOfEdges > 0 ? max(largest, edges[i].weight_) :
+			edges[i].weight_;
+		sum += edges[i].weight_;
+		numberOfEdges++;
+	}
+
+	vector<long> outHistogram, inHistogram;
+	for(int v = 0; v < size; v++) {
+		bin(outHistogram, outDegrees[v]);
+		bin(inHistogram, inDegrees[v]);
+	}
+	const double average = numberOfEdges > 0 ? sum / numberOfEdges : 0.0;
+
+	bool passed = true;
+	for(int threads = 1; threads <= 4; threads += 3) {
+		const GraphStatistics::Statistics statistics =
+			GraphStatistics(graph, threads).compute();
+
+		passed = passed && statistics.numberOfEdges_ == numberOfEdges &&
+			statistics.outDegree_.histogram_ == outHistogram &&
+			statistics.inDegree_.histogram_ == inHistogram &&
+			statistics.smallestWeight_ == smallest &&
+			statistics.largestWeight_ == largest &&
+			fabs(statistics.averageWeight_ - average) <= 1e-6 * max(1.0, average);
+	}
+
+	cout << name << " Statistics Check: " << (passed ? "Passed" : "FAILED")
+		  << endl;
+}
+
 int main(int argc, char**argv) {
 	if(argc != 2) {
 		cout << "Usage: " << argv[0] << " <maximum_number_of_nodes>"
@@ -30,6 +107,7 @@ int main(int argc, char**argv) {
 	// Create Graph, connections map (implemented via disjoint sets class),
 	// and possible unions (before only one set remains) count.
 	Graph testGraph(maxNumberofNodes);
+	vector<TestEdge> edges;
 	DisjSets connectionMap(maxNumberofNodes);
 	int numberOfUnionsPossible = maxNumberofNodes - 1;
 	
@@ -48,7 +126,15 @@ int main(int argc, char**argv) {
 			continue;
 		}
 		
-		// Add edge between vertices
+		// Add edge between vertices (recording new ones, with random weights)
+		if(testGraph.isConnected(originId, targetId) == -1.0) {
+			TestEdge there = {originId, targetId,
+									static_cast<float>(rand() % 100) / 10, false};
+			TestEdge back = {targetId, originId,
+								  static_cast<float>(rand() % 100) / 10, false};
+			edges.push_back(there);
+			edges.push_back(back);
+		}
 		testGraph.addEdge(originId, targetId, 1.0);
 		testGraph.addEdge(targetId, originId, 1.0);
 		
@@ -63,8 +149,36 @@ int main(int argc, char**argv) {
 		}
 	}
 	
-	// Output Graph degree information
+	// Output Graph degree information, then the full degree distributions
+	// (including the duplicate edges drawn along the way)
 	testGraph.outputDegreeInformation();
+	GraphStatistics(testGraph).outputStatistics();
+	
+	// Check the statistics of the same edges in a packed Graph: as built,
+	// with one edge removed from each vertex of at least 3 (too few to
+	// compact the vertex, so the Graph stays packed), and once compacted.
+	GraphBuilder builder(maxNumberofNodes);
+	for(size_t i = 0; i < edges.size(); i++) {
+		builder.addEdge(edges[i].from_, edges[i].to_, edges[i].weight_);
+	}
+	Graph packedGraph = builder.build();
+	checkStatistics("Packed", packedGraph, edges);
+	
+	vector<int> degrees(maxNumberofNodes, 0);
+	for(size_t i = 0; i < edges.size(); i++) {
+		degrees[edges[i].from_ - 1]++;
+	}
+	for(size_t i = 0; i < edges.size(); i++) {
+		if(degrees[edges[i].from_ - 1] >= 3) {
+			packedGraph.removeEdge(edges[i].from_, edges[i].to_);
+			edges[i].removed_ = true;
+			degrees[edges[i].from_ - 1] = 0;
+		}
+	}
+	checkStatistics("Removed Edge", packedGraph, edges);
+	
+	packedGraph.compact();
+	checkStatistics("Compacted", packedGraph, edges);
 	
 	
 	return 0;
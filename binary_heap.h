@@ -88,7 +88,7 @@ class BinaryHeap
      */
     void insert( Comparable && x )
     {
-        if( currentSize == array.size( ) - 1 )
+        if( currentSize == static_cast<int>(array.size( )) - 1 )
             array.resize( array.size( ) * 2 );
 
             // Percolate up